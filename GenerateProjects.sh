@@ -0,0 +1,4 @@
+#!/bin/sh
+# Generates Makefiles for Linux, then build with "make config=debug" (or release/dist)
+cd "$(dirname "$0")"
+vendor/bin/premake5 gmake2
@@ -5,6 +5,12 @@
 #include "Hazel/Application.h"
 #include "Hazel/Layer.h"
 #include "Hazel/Log.h"
+#include "Hazel/Timestep.h"
+#include "Hazel/Debug/Instrumentor.h"
+#include "Hazel/Jobs/JobSystem.h"
+#include "Hazel/Memory/AllocationTracker.h"
+#include "Hazel/Memory/FrameAllocator.h"
+#include "Hazel/Memory/PoolAllocator.h"
 
 #include "Hazel/Input.h"
 #include "Hazel/KeyCodes.h"
@@ -12,6 +18,18 @@
 
 #include "Hazel/ImGui/ImGuiLayer.h"
 
+// ---Renderer------------------------
+#include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/RenderQueue.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "Hazel/Renderer/Renderer2D.h"
+#include "Hazel/Renderer/Buffer.h"
+#include "Hazel/Renderer/VertexArray.h"
+#include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/Texture.h"
+// -----------------------------------
+
 // --------Entry Point--------
 #include "Hazel/EntryPoint.h"
 // ---------------------------
@@ -3,9 +3,14 @@
 
 #include "Hazel/Log.h"
 
-#include <glad/glad.h>
-
 #include "Input.h"
+#include "Hazel/Jobs/JobSystem.h"
+#include "Hazel/Memory/AllocationTracker.h"
+#include "Hazel/Memory/FrameAllocator.h"
+#include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/RenderThread.h"
+
+#include <cmath>
 
 
 namespace Hazel {
@@ -22,29 +27,43 @@ namespace Hazel {
 
 --  When the event occurs, GLFW calls a predefined callback function. Inside this callback, you retrieve the bound callable from the user pointer 
    and call it with the event.The EventCallback function then invokes OnEvent on the Application instance.
+
+-- BIND_EVENT_FN used to be a std::bind, it's now a lambda that captures "this" instead. It does the same job, but unlike std::bind it can 
+   be inlined by the compiler when passed to EventDispatcher::Dispatch, since the lambda's type is known there (no std::function needed).
 */
-#define BIND_EVENT_FN(x) std::bind(&Application::x, this, std::placeholders::_1) 
+#define BIND_EVENT_FN(x) [this](auto&&... args) -> decltype(auto) { return this->x(std::forward<decltype(args)>(args)...); }
 
 	Application* Application::s_Instance = nullptr;
+	static constexpr int s_RedrawFramesAfterInput = 3;
 
 	//In C++, the superclass constructor is invoked. Whenever a subclass constructor is invoked during an instantiation.
-	Application::Application() {
+	Application::Application(const WindowProps& props) {
+
+		HZ_PROFILE_FUNCTION();
 
 		HZ_CORE_ASSERT(!s_Instance, "Application already exists!");
 		s_Instance = this;
 
-		m_Window = std::unique_ptr<Window>(Window::Create());
+		m_Window = std::unique_ptr<Window>(Window::Create(props));
 		// SetEventCallback() sets the std::function<void(Event&)> attribute that m_Data.EventCallback is holding.
 		m_Window->SetEventCallback(BIND_EVENT_FN(OnEvent)); 
+		// Events get queued during glfwPollEvents(), and are only dispatched through OnEvent() in the event stage of Run().
+		m_Window->SetEventQueue(&m_EventQueue);
+
+		// A worker per core, for the layers to ParallelFor() their updates over. The main thread is one of them, while it waits.
+		JobSystem::Get().Start();
+
+		// From here on the context belongs to the render thread, every GL call (the ImGuiLayer's included) has to go through it.
+		if (RenderThread::IsEnabled())
+			RenderThread::Get().Start(&m_Window->GetGraphicsContext());
 
 		m_ImGuiLayer = new ImGuiLayer();
 		PushOverlay(m_ImGuiLayer);
 
-		glGenVertexArrays(1, &m_VertexArray);
-		glBindVertexArray(m_VertexArray);
+		// The window (and so the graphics context) has to exist before the RendererAPI is initialised.
+		Renderer::Init();
 
-		glGenBuffers(1, &m_VertexBuffer);
-		glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
+		m_VertexArray.reset(VertexArray::Create());
 
 		float vertices[3 * 3] = {
 			-0.5f, -0.5f, 0.0f,
@@ -52,16 +71,15 @@ namespace Hazel {
 			 0.0f,  0.5f, 0.0f
 		};
 
-		glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-		glEnableVertexAttribArray(0);
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
-
-		glGenBuffers(1, &m_IndexBuffer);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer);
+		std::shared_ptr<VertexBuffer> vertexBuffer(VertexBuffer::Create(vertices, sizeof(vertices)));
+		vertexBuffer->SetLayout({
+			{ ShaderDataType::Float3, "a_Position" }
+		});
+		m_VertexArray->AddVertexBuffer(vertexBuffer);
 
-		unsigned int indices[3] = {0, 1, 2};
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+		uint32_t indices[3] = {0, 1, 2};
+		std::shared_ptr<IndexBuffer> indexBuffer(IndexBuffer::Create(indices, sizeof(indices) / sizeof(uint32_t)));
+		m_VertexArray->SetIndexBuffer(indexBuffer);
 
 
 		std::string vertexSrc = R"(
@@ -69,13 +87,16 @@ namespace Hazel {
 			#version 330 core
 			
 			layout(location = 0) in vec3 a_Position;
+
+			uniform mat4 u_ViewProjection;
+			uniform mat4 u_Transform;
 			
 			out vec3 v_Position;
 
 			void main() {	
 
 				v_Position = a_Position;
-				gl_Position = vec4(a_Position, 1.0);
+				gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
 			}
 		)";
 
@@ -93,37 +114,66 @@ namespace Hazel {
 			}
 		)";
 
-		m_Shader.reset(new Shader(vertexSrc, fragmentSrc));
+		m_Shader = Renderer::GetShaderLibrary().Load("Triangle", vertexSrc, fragmentSrc);
 	}
 
-	Application::~Application() {}
+	Application::~Application() {
+
+		// Top of the stack first, the reverse of how they were attached, while the render thread still runs what they submit. (the
+		// ImGuiLayer's backend shuts down on it) The LayerStack only deletes them.
+		for (auto it = m_LayerStack.rbegin(); it != m_LayerStack.rend(); ++it)
+			(*it)->OnDetach();
+
+		JobSystem::Get().Stop();
+
+		// Runs what's left, and hands the context back to this thread. Everything destroyed from here on (the layers too) deletes its
+		// GL objects straight away.
+		RenderThread::Get().Stop();
+
+		// Resources have to go before the RendererAPI (and the context) they were created with.
+		m_Shader.reset();
+		m_VertexArray.reset();
+		Renderer::Shutdown();
+	}
 
 
 	// LayerStack Integration : "Application" now includes a LayerStack. It forwards events to layers and calls their update methods.
 	void Application::PushLayer(Layer* layer) {
+
+		HZ_PROFILE_FUNCTION();
+
 		m_LayerStack.PushLayer(layer);
 		layer->OnAttach();
 	}
 
 	void Application::PushOverlay(Layer* layer) {
+
+		HZ_PROFILE_FUNCTION();
+
 		m_LayerStack.PushOverlay(layer);
 		layer->OnAttach();
 	}
 
 
-	// This is the method that's invoked in the lambda functions of GLFW methods for events, such as { glfwSetWindowCloseCallback, glfwSetKeyCallback, etc. }
+	// This is the method that's invoked for every event drained from m_EventQueue in Run(). (or directly by the GLFW callbacks, such as
+	// { glfwSetWindowCloseCallback, glfwSetKeyCallback, etc. }, if the window has no EventQueue set)
 	void Application::OnEvent(Event& e) {
 
+		HZ_PROFILE_FUNCTION();
+
 		// Sets m_Event of EventDispatcher class as Event "e"
 		EventDispatcher dispatcher(e); 
 		
 		// The Dispatch method checks if the passed event (m_Event) matches the type specified in the template parameter.If it does, it calls the provided 
 		// function (parameter of type EventFN<T> func).
 		dispatcher.Dispatch<WindowCloseEvent>(BIND_EVENT_FN(OnWindowClose));
+		dispatcher.Dispatch<WindowResizeEvent>(BIND_EVENT_FN(OnWindowResize));
 
 
-		// Iterator loop, mimics Event Propagation order, from Top to Bottom of a stack. 
-		for (auto it = m_LayerStack.end(); it != m_LayerStack.begin(); ) {
+		// Iterator loop, mimics Event Propagation order, from Top to Bottom of a stack. Only goes through the layers subscribed to this 
+		// event's type, which are kept in the same order as the LayerStack.
+		const std::vector<Layer*>& subscribers = m_LayerStack.GetEventSubscribers(e);
+		for (auto it = subscribers.end(); it != subscribers.begin(); ) {
 			
 			(*--it)->OnEvent(e);
 			if (e.Handled)
@@ -134,28 +184,200 @@ namespace Hazel {
 
 	// Called from main function, where the main processes occurs during run-time
 	void Application::Run() {
+
+		HZ_PROFILE_FUNCTION();
+
+		// Every shader created up to here (the layers' included, in OnAttach) was created during startup.
+		RenderCommand::LogShaderCacheStats();
+
+		// The first frame's timestep starts here, not when the clock was created, which would make it the whole startup.
+		m_LastFrameTime = m_FrameClock.Elapsed();
 		
 		while (m_Running) {
 
-			glClearColor(0.2f, 0.2f, 0.5f, 1);
-			glClear(GL_COLOR_BUFFER_BIT);
+			HZ_PROFILE_SCOPE("RunLoop");
 
-			glBindVertexArray(m_VertexArray);
-			glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, nullptr);
+			// Render on demand: nothing to draw, so sleeps until the OS wakes us up with an event (or RequestRedraw() / the idle timeout).
+			// Whatever woke us up, one frame is then rendered.
+			if (m_RenderOnDemand && m_RedrawFrames == 0 && m_EventQueue.Empty()) {
+				HZ_PROFILE_SCOPE("Idle - Window::WaitEvents");
+				m_Window->WaitEvents(m_IdleTimeout);
+				// Nothing was simulated while idle, so the time spent waiting isn't part of the next timestep either.
+				m_LastFrameTime = m_FrameClock.Elapsed();
+			}
 
-			for (Layer* layer : m_LayerStack) {
-				layer->OnUpdate(); // Iterates through LayerStack to update each layers, from Bottom to Top of a stack. 
+			// Idle time isn't part of the frame, as far as the frame stats are concerned.
+			m_FrameStats.BeginFrame();
+			RenderCommand::BeginGPUFrame();
+			FrameAllocator::Get().NextFrame(); // frame memory from two frames ago is free again
+			AllocationTracker::NextFrame();
+
+			double time = m_FrameClock.Elapsed();
+			Timestep timestep = (float)(time - m_LastFrameTime);
+			m_LastFrameTime = time;
+
+			// Event stage: dispatches everything that was queued by the GLFW callbacks during last frame's glfwPollEvents().
+			{
+				HZ_PROFILE_SCOPE("Events - EventQueue::Dispatch");
+				ScopedFrameTimer stageTimer(m_FrameStats, FrameStage::Events);
+				HZ_ALLOCATION_TAG(Events);
+				m_EventQueue.Dispatch([this](Event& e) { OnEvent(e); });
 			}
 
-			m_ImGuiLayer->Begin();
-			for (Layer* layer : m_LayerStack) {
-				layer->OnImGuiRender();
+			// Shader files saved since the last look (every ShaderLibrary::WatchInterval) start recompiling, and are swapped in once linked.
+			Renderer::GetShaderLibrary().ReloadChanged();
+
+			// ImGui needs a couple of frames after an input to settle (hover states, popups opening, etc.)
+			if (m_EventQueue.GetLastFrameStats().Dispatched > 0)
+				RequestRedraw(s_RedrawFramesAfterInput);
+
+			{
+				HZ_PROFILE_SCOPE("Render - Triangle");
+				HZ_PROFILE_GPU_SCOPE("Triangle");
+				ScopedFrameTimer stageTimer(m_FrameStats, FrameStage::Render);
+				HZ_ALLOCATION_TAG(Renderer);
+
+				RenderCommand::SetClearColor({ 0.2f, 0.2f, 0.5f, 1 });
+				RenderCommand::Clear();
+
+				Renderer::BeginScene(glm::mat4(1.0f));
+				Renderer::Submit(m_Shader, m_VertexArray);
+				Renderer::EndScene();
+			}
+
+			if (m_FixedTimestep > 0.0f) {
+				ScopedFrameTimer stageTimer(m_FrameStats, FrameStage::FixedUpdate);
+				HZ_ALLOCATION_TAG(Layers);
+				FixedUpdate(timestep);
+			}
+
+			{
+				HZ_PROFILE_SCOPE("LayerStack OnUpdate");
+				ScopedFrameTimer stageTimer(m_FrameStats, FrameStage::Update);
+				HZ_ALLOCATION_TAG(Layers);
+
+				// Updates each layer, from Bottom to Top of the stack, the parallel ones on the JobSystem. They've all finished by the time this
+				// returns, so the ImGui stage sees every layer's update.
+				m_LayerStack.OnUpdate(timestep, m_FrameStats);
+			}
+
+			{
+				HZ_PROFILE_SCOPE("LayerStack OnImGuiRender");
+				HZ_ALLOCATION_TAG(ImGui);
+
+				{
+					ScopedFrameTimer stageTimer(m_FrameStats, FrameStage::ImGuiBuild);
+
+					m_ImGuiLayer->Begin();
+					for (Layer* layer : m_LayerStack) {
+						HZ_PROFILE_SCOPE(layer->GetProfileName());
+						Timer layerTimer;
+						layer->OnImGuiRender();
+						m_FrameStats.RecordLayerImGuiRender(layer->GetName(), (float)layerTimer.ElapsedMillis());
+					}
+				}
+
+				ScopedFrameTimer stageTimer(m_FrameStats, FrameStage::ImGuiRender);
+				m_ImGuiLayer->End();
+			}
+
+			RenderCommand::EndGPUFrame();
+
+			{
+				ScopedFrameTimer stageTimer(m_FrameStats, FrameStage::Swap);
+				HZ_ALLOCATION_TAG(Renderer);
+				m_Window->SwapBuffers();
+				// With a render thread, hands it this frame. The wait for the GPU happens over there, only when the render thread falls 
+				// behind does the main thread wait here.
+				RenderThread::Get().Kick();
+			}
+
+			if (m_RedrawFrames > 0)
+				m_RedrawFrames--;
+
+			// Waits for the next frame's deadline when the frame rate is capped. Happens before polling, so the events we then process 
+			// next frame are as fresh as possible, rather than having sat in the queue for the whole wait. (lower input latency)
+			{
+				ScopedFrameTimer stageTimer(m_FrameStats, FrameStage::Wait);
+				m_FrameLimiter.Wait();
 			}
-			m_ImGuiLayer->End();
 
-			// This processes the event queue, and then triggers any callbacks that have been setted. b
-			m_Window->OnUpdate(); // Poll Events, swaps buffer. Ran once per frame. 
+			// This processes the event queue, and then triggers any callbacks that have been setted. (which queue events in m_EventQueue)
+			{
+				ScopedFrameTimer stageTimer(m_FrameStats, FrameStage::Poll);
+				HZ_ALLOCATION_TAG(Events); // the Window's callbacks queue events
+				m_Window->PollEvents(); // Ran once per frame. 
+			}
+
+			m_FrameStats.EndFrame();
+
+			if (m_FrameLimit > 0 && ++m_FrameCount >= m_FrameLimit)
+				m_Running = false;
+		}
+	}
+
+	void Application::Close(int exitCode) {
+
+		m_ExitCode = exitCode;
+		m_Running = false;
+	}
+
+	void Application::SetRenderOnDemand(bool enabled, double idleTimeout) {
+
+		m_RenderOnDemand = enabled;
+		m_IdleTimeout = idleTimeout;
+		RequestRedraw();
+	}
+
+	void Application::RequestRedraw(int frames) {
+
+		// Only ever raises the count, so concurrent requests can't cancel each other out.
+		int current = m_RedrawFrames.load();
+		while (current < frames && !m_RedrawFrames.compare_exchange_weak(current, frames)) {}
+
+		if (m_RenderOnDemand)
+			m_Window->Wake();
+	}
+
+	void Application::SetTargetFrameRate(float framesPerSecond) {
+
+		if (framesPerSecond == FrameLimiter::MatchRefresh)
+			framesPerSecond = m_Window->GetRefreshRate();
+
+		m_FrameLimiter.SetTargetFrameRate(framesPerSecond);
+	}
+
+	void Application::SetFixedTimestep(float step, int maxStepsPerFrame) {
+
+		m_FixedTimestep = step;
+		m_MaxFixedSteps = maxStepsPerFrame;
+		m_FixedAccumulator = 0.0f;
+		m_InterpolationAlpha = 0.0f;
+	}
+
+	// Accumulator based fixed timestep. The simulation always advances in steps of m_FixedTimestep, no matter the frame rate, and the 
+	// leftover time is carried over to the next frame.
+	void Application::FixedUpdate(Timestep timestep) {
+
+		HZ_PROFILE_FUNCTION();
+
+		m_FixedAccumulator += timestep;
+
+		int steps = 0;
+		while (m_FixedAccumulator >= m_FixedTimestep && steps < m_MaxFixedSteps) {
+
+			for (Layer* layer : m_LayerStack) {
+				layer->OnFixedUpdate(m_FixedTimestep);
+			}
+			m_FixedAccumulator -= m_FixedTimestep;
+			steps++;
 		}
+
+		// Hit the clamp, the simulation can't keep up (or we sat on a breakpoint). Drops the backlog, instead of trying to catch up on it.
+		if (m_FixedAccumulator >= m_FixedTimestep)
+			m_FixedAccumulator = std::fmod(m_FixedAccumulator, m_FixedTimestep);
+
+		m_InterpolationAlpha = m_FixedAccumulator / m_FixedTimestep;
 	}
 
 	bool Application::OnWindowClose(WindowCloseEvent& e) {
@@ -163,4 +385,12 @@ namespace Hazel {
 		m_Running = false;
 		return true;
 	}
+
+	bool Application::OnWindowResize(WindowResizeEvent& e) {
+
+		// Sync point: the frames still in flight were recorded for the old size, they're finished before the first one at the new size.
+		RenderThread::Get().WaitIdle();
+		RenderCommand::SetViewport(0, 0, e.GetWidth(), e.GetHeight());
+		return false; // layers may want to know too
+	}
 }
\ No newline at end of file
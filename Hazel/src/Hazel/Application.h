@@ -4,49 +4,115 @@
 
 #include "Window.h"
 #include "Hazel/LayerStack.h"
+#include "Hazel/Timer.h"
+#include "Hazel/FrameLimiter.h"
+#include "Hazel/Debug/FrameStats.h"
 #include "Hazel/Events/Event.h"
 #include "Hazel/Events/ApplicationEvent.h"
+#include "Hazel/Events/EventQueue.h"
 
 #include "Hazel/ImGui/ImGuiLayer.h"
 
 #include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/Buffer.h"
+#include "Hazel/Renderer/VertexArray.h"
 
 
 namespace Hazel {
 
+	// main()'s argc and argv, handed to CreateApplication().
+	struct ApplicationCommandLineArgs {
+
+		int Count = 0;
+		char** Args = nullptr;
+
+		const char* operator[](int index) const {
+			HZ_CORE_ASSERT(index < Count, "Command line argument out of range!");
+			return Args[index];
+		}
+	};
+
 	class HAZEL_API Application {
 
 	public:
 
-		Application();
+		Application(const WindowProps& props = WindowProps());
 		virtual ~Application();
 		
 		void Run();
 		void OnEvent(Event& e);
 
+		// Ends Run() once the current frame is done, main() then returns exitCode.
+		void Close(int exitCode = 0);
+		inline int GetExitCode() const { return m_ExitCode; }
+		// Ends Run() after that many frames, 0 (the default) for no limit. So that a headless run (eg. on CI) ends by itself.
+		inline void SetFrameLimit(uint64_t frames) { m_FrameLimit = frames; }
+
 		void PushLayer(Layer* layer);
 		void PushOverlay(Layer* layer);
 
+		// Fixed timestep mode: every frame, Layer::OnFixedUpdate() is called once per "step" seconds of elapsed time, (at most 
+		// maxStepsPerFrame times, so a long frame can't snowball into even longer ones) before the usual Layer::OnUpdate(). 
+		// A step of 0 turns it off (the default).
+		void SetFixedTimestep(float step, int maxStepsPerFrame = 5);
+		inline float GetFixedTimestep() const { return m_FixedTimestep; }
+		// How far into the next fixed step we are [0, 1), to interpolate between the last two simulated states when rendering.
+		inline float GetInterpolationAlpha() const { return m_InterpolationAlpha; }
+
+		// Caps the frame rate (independently from VSync), FrameLimiter::Uncapped (default) and FrameLimiter::MatchRefresh work too.
+		void SetTargetFrameRate(float framesPerSecond);
+		inline const FrameLimiter& GetFrameLimiter() const { return m_FrameLimiter; }
+		// CPU time of every stage of the last frames, and of each layer. (shown in the ImGuiLayer's performance panel)
+		inline const FrameStats& GetFrameStats() const { return m_FrameStats; }
+
+		// Render on demand: instead of rendering continuously, the loop sleeps in Window::WaitEvents() until there's input, a 
+		// RequestRedraw(), or idleTimeout seconds have passed (0 to never time out). Meant for editor-style tools that sit idle a lot.
+		void SetRenderOnDemand(bool enabled, double idleTimeout = 0.0);
+		inline bool IsRenderOnDemand() const { return m_RenderOnDemand; }
+		// Asks for (at least) the next frames to be rendered in render on demand mode. Can be called from any thread.
+		void RequestRedraw(int frames = 1);
+
 		inline Window& GetWindow() { return *m_Window; }
+		inline EventQueue& GetEventQueue() { return m_EventQueue; }
 		inline static Application& Get() { return *s_Instance;  }
 
 	private:
 
 		bool OnWindowClose(WindowCloseEvent& e);
+		bool OnWindowResize(WindowResizeEvent& e);
+		void FixedUpdate(Timestep timestep);
 
 	private:
 
 		std::unique_ptr<Window> m_Window;
+		EventQueue m_EventQueue;
 		ImGuiLayer* m_ImGuiLayer;
 		bool m_Running = true;
+		int m_ExitCode = 0;
+		uint64_t m_FrameLimit = 0;
+		uint64_t m_FrameCount = 0;
 		LayerStack m_LayerStack;
 
-		unsigned int m_VertexArray, m_VertexBuffer, m_IndexBuffer;
-		std::unique_ptr<Shader> m_Shader; // unique pointer disposes the pointer it holds when it goes out of scope. 
+		FrameLimiter m_FrameLimiter;
+		FrameStats m_FrameStats;
+
+		bool m_RenderOnDemand = false;
+		double m_IdleTimeout = 0.0;
+		std::atomic<int> m_RedrawFrames = 0;
+		Timer m_FrameClock;
+		double m_LastFrameTime = 0.0;
+
+		float m_FixedTimestep = 0.0f;
+		int m_MaxFixedSteps = 5;
+		float m_FixedAccumulator = 0.0f;
+		float m_InterpolationAlpha = 0.0f;
+
+		std::shared_ptr<VertexArray> m_VertexArray;
+		std::shared_ptr<Shader> m_Shader;
 
 		static Application* s_Instance;
 	};
 
 	//To be defined in CLIENT (SandboxApp.cpp)
-	Application* CreateApplication();
+	Application* CreateApplication(ApplicationCommandLineArgs args);
 }
\ No newline at end of file
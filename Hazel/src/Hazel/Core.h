@@ -11,8 +11,17 @@
 	#else 
 		#define HAZEL_API
 	#endif
+#elif defined(HZ_PLATFORM_LINUX)
+	#define HAZEL_API // always a static library on Linux
 #else
-	#error Hazel only supports Windows!
+	#error Hazel only supports Windows and Linux!
+#endif
+
+#ifdef HZ_PLATFORM_WINDOWS
+	#define HZ_DEBUGBREAK() __debugbreak()
+#else
+	#include <csignal>
+	#define HZ_DEBUGBREAK() raise(SIGTRAP)
 #endif
 
 #ifdef HZ_DEBUG
@@ -21,8 +30,8 @@
 
 // "ASSERT" checks if the input is true (if it works out), and then it will output its __VA_ARGS__
 #ifdef HZ_ENABLE_ASSERTS
-	#define HZ_ASSERT(x, ...) { if(!(x)) { HZ_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
-	#define HZ_CORE_ASSERT(x, ...) { if(!(x)) { HZ_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
+	#define HZ_ASSERT(x, ...) { if(!(x)) { HZ_ERROR("Assertion Failed: {0}", __VA_ARGS__); HZ_DEBUGBREAK(); } }
+	#define HZ_CORE_ASSERT(x, ...) { if(!(x)) { HZ_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); HZ_DEBUGBREAK(); } }
 #else
 	#define HZ_ASSERT(x, ...) // These are used when in Dist and Release build, as they get stripped and does nothing. 
 	#define HZ_CORE_ASSERT(x, ...)
@@ -30,4 +39,5 @@
 
 #define BIT(x) (1 << x)
 
-#define HZ_BIND_EVENT_FN(fn) std::bind(&fn, this, std::placeholders::_1)
+// A lambda rather than std::bind, so that it can be inlined when passed to EventDispatcher::Dispatch (and never needs to allocate)
+#define HZ_BIND_EVENT_FN(fn) [this](auto&&... args) -> decltype(auto) { return this->fn(std::forward<decltype(args)>(args)...); }
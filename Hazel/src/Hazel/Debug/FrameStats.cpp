@@ -0,0 +1,138 @@
+#include "hzpch.h"
+#include "FrameStats.h"
+
+#include <cmath>
+
+
+namespace Hazel {
+
+	const char* FrameStageToString(FrameStage stage) {
+
+		switch (stage) {
+
+			case FrameStage::Events:		return "Events";
+			case FrameStage::FixedUpdate:	return "FixedUpdate";
+			case FrameStage::Update:		return "Update";
+			case FrameStage::Render:		return "Render";
+			case FrameStage::ImGuiBuild:	return "ImGui Build";
+			case FrameStage::ImGuiRender:	return "ImGui Render";
+			case FrameStage::Swap:			return "Swap";
+			case FrameStage::Wait:			return "Wait";
+			case FrameStage::Poll:			return "Poll";
+			default:						return "Unknown";
+		}
+	}
+
+	void TimingHistory::Push(float milliseconds) {
+
+		m_Samples[m_Index] = milliseconds;
+		m_Index = (m_Index + 1) % HistorySize;
+		m_Count = std::min(m_Count + 1, HistorySize);
+	}
+
+	void TimingHistory::Clear() {
+
+		m_Index = 0;
+		m_Count = 0;
+	}
+
+	TimingSummary TimingHistory::Summarize() const {
+
+		TimingSummary summary;
+		if (m_Count == 0)
+			return summary;
+
+		float sorted[HistorySize];
+		std::copy(m_Samples, m_Samples + m_Count, sorted);
+		std::sort(sorted, sorted + m_Count);
+
+		// Nearest-rank percentile
+		auto percentile = [&](float p) { return sorted[std::min(m_Count - 1, (size_t)std::ceil(p * m_Count) - 1)]; };
+
+		float sum = 0.0f;
+		for (size_t i = 0; i < m_Count; i++)
+			sum += sorted[i];
+
+		summary.Min = sorted[0];
+		summary.Average = sum / m_Count;
+		summary.P95 = percentile(0.95f);
+		summary.P99 = percentile(0.99f);
+		summary.Max = sorted[m_Count - 1];
+		return summary;
+	}
+
+	void FrameStats::BeginFrame() {
+
+		m_FrameStart = Clock::now();
+	}
+
+	void FrameStats::EndFrame() {
+
+		m_Frame.Push(std::chrono::duration<float, std::milli>(Clock::now() - m_FrameStart).count());
+
+		for (int i = 0; i < (int)FrameStage::Count; i++) {
+			m_Stages[i].Push(m_CurrentStages[i]);
+			m_CurrentStages[i] = 0.0f;
+		}
+
+		// A layer that didn't run this frame (popped, or not pushed yet) keeps its history as it was.
+		for (LayerTimings& layer : m_Layers) {
+
+			if (!layer.Ran)
+				continue;
+
+			layer.Update.Push(layer.CurrentUpdate);
+			layer.ImGuiRender.Push(layer.CurrentImGuiRender);
+			layer.CurrentUpdate = 0.0f;
+			layer.CurrentImGuiRender = 0.0f;
+			layer.Ran = false;
+		}
+	}
+
+	void FrameStats::Record(FrameStage stage, float milliseconds) {
+
+		m_CurrentStages[(int)stage] += milliseconds;
+	}
+
+	void FrameStats::RecordLayerUpdate(const std::string& layerName, float milliseconds) {
+
+		LayerTimings& layer = GetLayer(layerName);
+		layer.CurrentUpdate += milliseconds;
+		layer.Ran = true;
+	}
+
+	void FrameStats::RecordLayerImGuiRender(const std::string& layerName, float milliseconds) {
+
+		LayerTimings& layer = GetLayer(layerName);
+		layer.CurrentImGuiRender += milliseconds;
+		layer.Ran = true;
+	}
+
+	void FrameStats::Clear() {
+
+		m_Frame.Clear();
+		for (TimingHistory& stage : m_Stages)
+			stage.Clear();
+
+		m_Layers.clear();
+		m_LastLayer = 0;
+	}
+
+	LayerTimings& FrameStats::GetLayer(const std::string& layerName) {
+
+		// Layers are recorded in the same order every frame, so the one after the last lookup is almost always the right one.
+		for (size_t i = 0; i < m_Layers.size(); i++) {
+
+			size_t index = (m_LastLayer + i) % m_Layers.size();
+			if (m_Layers[index].Name == layerName) {
+				m_LastLayer = (index + 1) % m_Layers.size();
+				return m_Layers[index];
+			}
+		}
+
+		m_Layers.emplace_back();
+		m_Layers.back().Name = layerName;
+		m_LastLayer = 0;
+		return m_Layers.back();
+	}
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Hazel/Core.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+
+namespace Hazel {
+
+	// The stages of a frame in Application::Run, in the order they happen.
+	enum class FrameStage {
+		Events = 0,		// EventQueue::Dispatch
+		FixedUpdate,	// Layer::OnFixedUpdate, only in fixed timestep mode
+		Update,			// Layer::OnUpdate, every layer
+		Render,			// the engine's own drawing
+		ImGuiBuild,		// ImGuiLayer::Begin() and Layer::OnImGuiRender, every layer
+		ImGuiRender,	// ImGuiLayer::End(), ImGui::Render and the OpenGL backend, plus the extra viewports
+		Swap,			// Window::SwapBuffers, and RenderThread::Kick when there's a render thread
+		Wait,			// FrameLimiter::Wait
+		Poll,			// Window::PollEvents
+		Count
+	};
+
+	const char* FrameStageToString(FrameStage stage);
+
+	// min/avg/percentiles over a TimingHistory, in milliseconds.
+	struct TimingSummary {
+
+		float Min = 0.0f;
+		float Average = 0.0f;
+		float P95 = 0.0f;
+		float P99 = 0.0f;
+		float Max = 0.0f;
+	};
+
+
+	class HAZEL_API TimingHistory {
+	// Ring buffer of the last HistorySize samples of one timing, in milliseconds.
+	public:
+
+		static constexpr size_t HistorySize = 300; // 5 seconds at 60fps
+
+		void Push(float milliseconds);
+		void Clear();
+
+		// Sorts a copy of the samples for the percentiles, so it's meant to be called when the numbers are shown, not every frame.
+		TimingSummary Summarize() const;
+
+		inline const float* GetSamples() const { return m_Samples; }
+		inline size_t GetCount() const { return m_Count; }
+		// Index of the oldest sample, for ImGui::PlotLines' values_offset.
+		inline size_t GetOffset() const { return m_Count < HistorySize ? 0 : m_Index; }
+		inline float GetLatest() const { return m_Count ? m_Samples[(m_Index + HistorySize - 1) % HistorySize] : 0.0f; }
+
+	private:
+
+		float m_Samples[HistorySize] = {};
+		size_t m_Index = 0;
+		size_t m_Count = 0;
+	};
+
+
+	struct LayerTimings {
+
+		std::string Name;
+		TimingHistory Update;		// Layer::OnUpdate
+		TimingHistory ImGuiRender;	// Layer::OnImGuiRender
+
+		// Accumulated during the current frame, pushed into the histories by FrameStats::EndFrame().
+		float CurrentUpdate = 0.0f;
+		float CurrentImGuiRender = 0.0f;
+		bool Ran = false;
+	};
+
+
+	class HAZEL_API FrameStats {
+	// Per-frame CPU timings of Application::Run, by stage and by layer, kept over the last TimingHistory::HistorySize frames for the
+	// performance panel. (see ImGuiLayer) Layers are keyed by Layer::GetName(), so two layers with the same name share their timings.
+	public:
+
+		using Clock = std::chrono::steady_clock;
+
+		void BeginFrame();
+		void EndFrame();
+
+		void Record(FrameStage stage, float milliseconds);
+		void RecordLayerUpdate(const std::string& layerName, float milliseconds);
+		void RecordLayerImGuiRender(const std::string& layerName, float milliseconds);
+
+		inline const TimingHistory& GetFrameHistory() const { return m_Frame; }
+		inline const TimingHistory& GetStageHistory(FrameStage stage) const { return m_Stages[(int)stage]; }
+		inline const std::vector<LayerTimings>& GetLayerTimings() const { return m_Layers; }
+
+		void Clear();
+
+	private:
+
+		LayerTimings& GetLayer(const std::string& layerName);
+
+	private:
+
+		Clock::time_point m_FrameStart;
+		TimingHistory m_Frame;
+		TimingHistory m_Stages[(int)FrameStage::Count];
+		float m_CurrentStages[(int)FrameStage::Count] = {};
+
+		std::vector<LayerTimings> m_Layers; // in the order they were first seen, which is the LayerStack's order
+		size_t m_LastLayer = 0;
+	};
+
+
+	class ScopedFrameTimer {
+	// Times a scope into the given FrameStats stage.
+	public:
+
+		ScopedFrameTimer(FrameStats& stats, FrameStage stage)
+			: m_Stats(stats), m_Stage(stage), m_Start(FrameStats::Clock::now()) {}
+
+		~ScopedFrameTimer() {
+			m_Stats.Record(m_Stage, std::chrono::duration<float, std::milli>(FrameStats::Clock::now() - m_Start).count());
+		}
+
+	private:
+
+		FrameStats& m_Stats;
+		FrameStage m_Stage;
+		FrameStats::Clock::time_point m_Start;
+	};
+}
@@ -0,0 +1,172 @@
+#include "hzpch.h"
+#include "Instrumentor.h"
+
+#include <fstream>
+#include <iomanip>
+
+
+namespace Hazel {
+
+	static std::atomic<uint32_t> s_NextThreadID = 0;
+
+	Instrumentor::ThreadBuffer::ThreadBuffer(uint32_t threadID)
+		: ThreadID(threadID), Head(new Chunk()), Tail(Head) {}
+
+	Instrumentor::ThreadBuffer::~ThreadBuffer() {
+
+		Chunk* chunk = Head;
+		while (chunk) {
+			Chunk* next = chunk->Next.load(std::memory_order_relaxed);
+			delete chunk;
+			chunk = next;
+		}
+	}
+
+	void Instrumentor::ThreadBuffer::Push(const ProfileResult& result) {
+
+		// Only ever called by the thread owning this buffer, so Tail and the chunk's Count can't change under us.
+		uint32_t count = Tail->Count.load(std::memory_order_relaxed);
+		if (count == Chunk::Capacity) {
+
+			Chunk* chunk = new Chunk();
+			Tail->Next.store(chunk, std::memory_order_release);
+			Tail = chunk;
+			count = 0;
+		}
+
+		Tail->Results[count] = result;
+		Tail->Count.store(count + 1, std::memory_order_release);
+	}
+
+	Instrumentor& Instrumentor::Get() {
+
+		static Instrumentor instance;
+		return instance;
+	}
+
+	void Instrumentor::BeginSession(const std::string& name, const std::string& filepath, uint32_t maxScopes) {
+
+		if (IsSessionActive()) {
+			HZ_CORE_WARN("Instrumentor::BeginSession('{0}') while session '{1}' is still open, ending it first.", name, m_SessionName);
+			EndSession();
+		}
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_SessionName = name;
+		m_Filepath = filepath;
+		m_SessionStart.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+		m_ChunksLeft.store(((int64_t)maxScopes + Chunk::Capacity - 1) / Chunk::Capacity, std::memory_order_relaxed);
+		m_SessionID.fetch_add(1, std::memory_order_relaxed);
+		m_Active.store(true, std::memory_order_release);
+	}
+
+	void Instrumentor::EndSession() {
+
+		if (!m_Active.exchange(false, std::memory_order_acq_rel))
+			return;
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		WriteSession();
+		m_Buffers.clear();
+	}
+
+	void Instrumentor::WriteProfile(const char* name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+
+		ThreadBuffer& buffer = GetThreadBuffer();
+
+		// Once per chunk, the only time the threads share anything while recording.
+		if (buffer.Tail->Count.load(std::memory_order_relaxed) == Chunk::Capacity && !buffer.Full)
+			buffer.Full = m_ChunksLeft.fetch_sub(1, std::memory_order_relaxed) <= 0;
+		if (buffer.Full) {
+			buffer.Dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		std::chrono::steady_clock::time_point sessionStart{ std::chrono::steady_clock::duration(m_SessionStart.load(std::memory_order_relaxed)) };
+
+		ProfileResult result;
+		result.Name = name;
+		result.Start = std::chrono::duration_cast<std::chrono::nanoseconds>(start - sessionStart).count();
+		result.Duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+		buffer.Push(result);
+	}
+
+	const char* Instrumentor::InternName(const std::string& name) {
+
+		std::lock_guard<std::mutex> lock(m_NamesMutex);
+		return m_Names.insert(name).first->c_str();
+	}
+
+	Instrumentor::ThreadBuffer& Instrumentor::GetThreadBuffer() {
+
+		thread_local uint32_t threadID = s_NextThreadID.fetch_add(1, std::memory_order_relaxed);
+		thread_local std::shared_ptr<ThreadBuffer> buffer;
+
+		// Slow path, once per thread per session: hands the session a fresh buffer, the previous one (if any) belonged to an older session.
+		if (!buffer || buffer->SessionID != m_SessionID.load(std::memory_order_relaxed)) {
+
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			buffer = std::make_shared<ThreadBuffer>(threadID);
+			buffer->SessionID = m_SessionID.load(std::memory_order_relaxed);
+			m_Buffers.push_back(buffer);
+		}
+
+		return *buffer;
+	}
+
+	static void WriteEscaped(std::ostream& out, const char* str) {
+
+		for (; *str; str++) {
+			if (*str == '"' || *str == '\\')
+				out << '\\';
+			out << *str;
+		}
+	}
+
+	// Chrome's Trace Event Format, "X" (complete) events with microsecond timestamps. Opens in chrome://tracing and ui.perfetto.dev
+	void Instrumentor::WriteSession() {
+
+		std::ofstream out(m_Filepath);
+		if (!out.is_open()) {
+			HZ_CORE_ERROR("Instrumentor could not open '{0}' to write profiling session '{1}'!", m_Filepath, m_SessionName);
+			return;
+		}
+
+		out << std::fixed << std::setprecision(3);
+		out << "{\"otherData\": {\"session\": \"";
+		WriteEscaped(out, m_SessionName.c_str());
+		out << "\"},\"traceEvents\":[";
+
+		bool first = true;
+		size_t eventCount = 0;
+		uint64_t dropped = 0;
+		for (const std::shared_ptr<ThreadBuffer>& buffer : m_Buffers) {
+
+			dropped += buffer->Dropped.load(std::memory_order_relaxed);
+
+			for (Chunk* chunk = buffer->Head; chunk; chunk = chunk->Next.load(std::memory_order_acquire)) {
+
+				uint32_t count = chunk->Count.load(std::memory_order_acquire);
+				for (uint32_t i = 0; i < count; i++) {
+
+					const ProfileResult& result = chunk->Results[i];
+
+					out << (first ? "\n" : ",\n");
+					out << "{\"cat\":\"function\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->ThreadID;
+					out << ",\"ts\":" << result.Start / 1000.0 << ",\"dur\":" << result.Duration / 1000.0 << ",\"name\":\"";
+					WriteEscaped(out, result.Name);
+					out << "\"}";
+
+					first = false;
+					eventCount++;
+				}
+			}
+		}
+
+		out << "\n]}";
+		HZ_CORE_INFO("Wrote profiling session '{0}' ({1} scopes) to '{2}'", m_SessionName, eventCount, m_Filepath);
+		if (dropped > 0)
+			HZ_CORE_WARN("Profiling session '{0}' was full, {1} scopes were dropped.", m_SessionName, dropped);
+	}
+}
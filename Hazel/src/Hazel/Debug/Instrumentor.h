@@ -0,0 +1,164 @@
+#pragma once
+
+#include "Hazel/Core.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+
+namespace Hazel {
+
+	// One completed scope. Name has to outlive the session, which is the case for string literals, __FUNCSIG__ and InternName()'s.
+	struct ProfileResult {
+
+		const char* Name;
+		int64_t Start;		// nanoseconds since the session began
+		int64_t Duration;	// nanoseconds
+	};
+
+
+	class HAZEL_API Instrumentor {
+	// Records timed scopes (see HZ_PROFILE_SCOPE / HZ_PROFILE_FUNCTION) and writes them as a chrome://tracing / Perfetto JSON file when
+	// the session ends. Every thread writes into its own buffer, so recording a scope never takes a lock or touches another thread's data.
+	// A thread only locks once per session, the first time it records something, to register its buffer. The buffers are merged and
+	// written out in EndSession(), so file IO never happens mid-frame.
+	// A session keeps at most maxScopes scopes, (rounded up to whole chunks) the ones recorded after that are dropped and counted, so a
+	// session left open for a long time can't eat all the memory.
+	public:
+
+		static constexpr uint32_t DefaultMaxScopes = 1 << 20; // about 24MB of ProfileResults, and a ~100MB file
+
+		Instrumentor(const Instrumentor&) = delete;
+		Instrumentor& operator=(const Instrumentor&) = delete;
+
+		// Starts recording, ending the current session first if there is one.
+		void BeginSession(const std::string& name, const std::string& filepath = "HazelProfile.json", uint32_t maxScopes = DefaultMaxScopes);
+		void EndSession();
+
+		inline bool IsSessionActive() const { return m_Active.load(std::memory_order_acquire); }
+
+		void WriteProfile(const char* name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+
+		// A copy of name that lives until the program exits, for scopes named at runtime. (eg. after a layer) Takes a lock, and every
+		// distinct name is kept, so it's meant for a handful of names used over and over, not for one per scope.
+		const char* InternName(const std::string& name);
+
+		static Instrumentor& Get();
+
+	private:
+
+		// Events are stored in fixed-size chunks, so a buffer grows without ever moving what was already recorded. Count and Next are
+		// published with release stores, which lets EndSession() read another thread's buffer safely while that thread keeps appending.
+		struct Chunk {
+
+			static constexpr uint32_t Capacity = 4096;
+
+			ProfileResult Results[Capacity];
+			std::atomic<uint32_t> Count = 0;
+			std::atomic<Chunk*> Next = nullptr;
+		};
+
+		struct ThreadBuffer {
+
+			ThreadBuffer(uint32_t threadID);
+			~ThreadBuffer();
+
+			void Push(const ProfileResult& result);
+
+			uint32_t ThreadID;
+			uint64_t SessionID = 0;
+			Chunk* Head;
+			Chunk* Tail;
+			bool Full = false;					// the session ran out of chunks, owner only
+			std::atomic<uint64_t> Dropped = 0;	// scopes that didn't fit, read by EndSession()
+		};
+
+		Instrumentor() = default;
+
+		ThreadBuffer& GetThreadBuffer();
+		void WriteSession();
+
+	private:
+
+		std::mutex m_Mutex; // guards the session itself and m_Buffers, never taken while recording a scope
+		std::atomic<bool> m_Active = false;
+		std::atomic<uint64_t> m_SessionID = 0;
+		std::string m_SessionName;
+		std::string m_Filepath;
+
+		// Read by every thread that records a scope, without the lock. The start is in steady_clock ticks since its epoch.
+		std::atomic<std::chrono::steady_clock::rep> m_SessionStart = 0;
+		std::atomic<int64_t> m_ChunksLeft = 0;
+
+		std::mutex m_NamesMutex;
+		std::unordered_set<std::string> m_Names; // InternName()'s, node based so their c_str()s never move
+
+		// Shared with the threads' thread_local handles, so a thread that outlives the session (or a session that outlives a thread)
+		// never ends up with a dangling buffer.
+		std::vector<std::shared_ptr<ThreadBuffer>> m_Buffers;
+	};
+
+
+	class InstrumentationTimer {
+	// RAII scope timer, records itself with the Instrumentor when it goes out of scope.
+	public:
+
+		InstrumentationTimer(const char* name)
+			: m_Name(name), m_Start(std::chrono::steady_clock::now()) {}
+
+		// A name that may not outlive the session, it's interned, (only while a session is recording) see Instrumentor::InternName().
+		InstrumentationTimer(const std::string& name)
+			: m_Name(Instrumentor::Get().IsSessionActive() ? Instrumentor::Get().InternName(name) : nullptr),
+			  m_Start(std::chrono::steady_clock::now()) {}
+
+		~InstrumentationTimer() {
+
+			if (m_Name && Instrumentor::Get().IsSessionActive())
+				Instrumentor::Get().WriteProfile(m_Name, m_Start, std::chrono::steady_clock::now());
+		}
+
+	private:
+
+		const char* m_Name;
+		std::chrono::steady_clock::time_point m_Start;
+	};
+}
+
+
+// Profiling is on in Debug and Release, and compiles out entirely in Dist. Define HZ_PROFILE as 0 or 1 before this header to override.
+#ifndef HZ_PROFILE
+	#ifdef HZ_DIST
+		#define HZ_PROFILE 0
+	#else
+		#define HZ_PROFILE 1
+	#endif
+#endif
+
+#if HZ_PROFILE
+	#if defined(_MSC_VER)
+		#define HZ_FUNC_SIG __FUNCSIG__
+	#elif defined(__GNUC__) || defined(__clang__)
+		#define HZ_FUNC_SIG __PRETTY_FUNCTION__
+	#else
+		#define HZ_FUNC_SIG __func__
+	#endif
+
+	#define HZ_PROFILE_CONCAT_IMPL(a, b) a##b
+	#define HZ_PROFILE_CONCAT(a, b) HZ_PROFILE_CONCAT_IMPL(a, b)
+
+	#define HZ_PROFILE_BEGIN_SESSION(name, filepath) ::Hazel::Instrumentor::Get().BeginSession(name, filepath)
+	#define HZ_PROFILE_END_SESSION() ::Hazel::Instrumentor::Get().EndSession()
+	// name is a string literal, (or otherwise outlives the session) it's stored as a pointer, or a std::string, which gets interned.
+	#define HZ_PROFILE_SCOPE(name) ::Hazel::InstrumentationTimer HZ_PROFILE_CONCAT(timer, __LINE__)(name)
+	#define HZ_PROFILE_FUNCTION() HZ_PROFILE_SCOPE(HZ_FUNC_SIG)
+#else
+	#define HZ_PROFILE_BEGIN_SESSION(name, filepath)
+	#define HZ_PROFILE_END_SESSION()
+	#define HZ_PROFILE_SCOPE(name)
+	#define HZ_PROFILE_FUNCTION()
+#endif
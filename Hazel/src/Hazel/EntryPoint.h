@@ -1,11 +1,11 @@
 #pragma once
 
 
-#ifdef HZ_PLATFORM_WINDOWS
+#if defined(HZ_PLATFORM_WINDOWS) || defined(HZ_PLATFORM_LINUX)
 	
 
-extern Hazel::Application* Hazel::CreateApplication(); // extern marks that a variable of function exists externally to this source file. 
-													   // This function is defined in SandboxApp.cpp
+// extern marks that a variable of function exists externally to this source file. This function is defined in SandboxApp.cpp
+extern Hazel::Application* Hazel::CreateApplication(Hazel::ApplicationCommandLineArgs args);
 
 int main(int argc, char** argv) {
 
@@ -15,12 +15,24 @@ int main(int argc, char** argv) {
 	int a = 5;
 	HZ_TRACE("Initialised Log! = {0}", a);    //Hazel::Log::GetClientLogger()->info("Initialised Log!");
 
+	// Each phase gets its own profiling session (and file), open them in chrome://tracing or ui.perfetto.dev
+	// A session keeps its first Instrumentor::DefaultMaxScopes scopes, (a few minutes of Runtime frames) and drops the rest.
 	//Initialising the application
-	auto app = Hazel::CreateApplication();
+	HZ_PROFILE_BEGIN_SESSION("Startup", "HazelProfile-Startup.json");
+	auto app = Hazel::CreateApplication({ argc, argv });
+	HZ_PROFILE_END_SESSION();
+
+	HZ_PROFILE_BEGIN_SESSION("Runtime", "HazelProfile-Runtime.json");
 	app->Run();
+	HZ_PROFILE_END_SESSION();
+
+	int exitCode = app->GetExitCode();
+
+	HZ_PROFILE_BEGIN_SESSION("Shutdown", "HazelProfile-Shutdown.json");
 	delete app;
+	HZ_PROFILE_END_SESSION();
 
-	return 0;
+	return exitCode;
 }
 
 #endif
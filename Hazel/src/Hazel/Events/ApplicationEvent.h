@@ -10,7 +10,7 @@ namespace Hazel {
 	public:
 
 		WindowResizeEvent(unsigned int width, unsigned int height)
-			: m_Width(width), m_Height(height)
+			: Event(GetStaticType()), m_Width(width), m_Height(height)
 		{}
 
 		inline unsigned int GetWidth() const { return m_Width; }
@@ -38,7 +38,9 @@ namespace Hazel {
 		
 	public:
 
-		WindowCloseEvent() {} //default constructor
+		WindowCloseEvent() //default constructor
+			: Event(GetStaticType())
+		{}
 
 		//Macro, to declare the specific getters for WindowCloseEvent class
 		EVENT_CLASS_TYPE(WindowClose)
@@ -51,10 +53,12 @@ namespace Hazel {
 		
 	public:
 
-		AppTickEvent() {} //default constructor
+		AppTickEvent() //default constructor
+			: Event(GetStaticType())
+		{}
 
 		//Macro, to declare the specific getters for AppTickEvent class
-		EVENT_CLASS_TYPE(AppUpdate)
+		EVENT_CLASS_TYPE(AppTick)
 		//Macro, to declare category flag of AppTickEvent class [0b00001]
 		EVENT_CLASS_CATEGORY(EventCategoryApplication)
 	};
@@ -64,10 +68,12 @@ namespace Hazel {
 		
 	public:
 		
-		AppRenderEvent() {} //default constructor
+		AppRenderEvent() //default constructor
+			: Event(GetStaticType())
+		{}
 
 		//Macro, to declare the specific getters for AppRenderEvent class
-		EVENT_CLASS_TYPE(AppUpdate)
+		EVENT_CLASS_TYPE(AppRender)
 		//Macro, to declare category flag of AppRenderEvent class [0b00001]
 		EVENT_CLASS_CATEGORY(EventCategoryApplication)
 	};
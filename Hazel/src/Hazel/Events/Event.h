@@ -2,13 +2,16 @@
 
 #include "hzpch.h"
 #include "Hazel/Core.h"
+#include "Hazel/Memory/PoolAllocator.h"
 
 
 namespace Hazel {
 
-	// Events in Hazel are currently blocking, meaning when an event occurs it immeadiately gets dispatached and must be
-	// dealth with right then an there. For the future, a better strategy might be to buffer events in an event bus and process
-	// them during the "event" part of the update stage.
+	// Events in Hazel are buffered. The GLFW callbacks copy them into the Application's EventQueue (see EventQueue.h) while polling,
+	// and they are then processed all at once during the "event" part of the update stage, at the start of the next frame. 
+	// An Event is only blocking (dispatched immediately) when the Window has no EventQueue set.
+	// Events that have to live on their own, (recorded, forwarded to another thread) are made with MakeEvent<T>(), and come from the
+	// PoolAllocator rather than the heap.
 
 	enum class EventType { // scoped, more type safety, 
 		None = 0,
@@ -18,6 +21,18 @@ namespace Hazel {
 		MouseButtonPressed, MouseButtonReleased, MouseMoved, MouseScrolled
 	};
 
+	// Number of EventTypes, for tables indexed by EventType. (must follow the last entry above)
+	constexpr size_t EventTypeCount = (size_t)EventType::MouseScrolled + 1;
+
+	// EventType sets as bitmasks, one bit per EventType. eg. EventTypeMask<KeyPressedEvent, KeyReleasedEvent>(), used by Layer subscriptions.
+	static_assert(EventTypeCount <= 32, "EventType bitmasks are 32 bits wide");
+	constexpr uint32_t AllEventTypes = 0xFFFFFFFF;
+
+	constexpr uint32_t EventTypeBit(EventType type) { return 1u << (uint32_t)type; }
+
+	template<typename... Events>
+	constexpr uint32_t EventTypeMask() { return (0u | ... | EventTypeBit(Events::GetStaticType())); }
+
 	//left bitwise operator shit by ~
 	enum EventCategory { // unscoped, less type safety, 
 		None = 0,
@@ -29,8 +44,9 @@ namespace Hazel {
 	};
 
 
-#define EVENT_CLASS_TYPE(type)  static EventType GetStaticType() { return EventType::type; }\
-								virtual EventType GetEventType() const override { return GetStaticType(); }\
+// GetStaticType() is constexpr, so comparing it against Event::GetEventType() (a plain member read, see below) compiles down to
+// an integer compare, and a chain of EventDispatcher::Dispatch calls into the equivalent of a switch over EventType.
+#define EVENT_CLASS_TYPE(type)  static constexpr EventType GetStaticType() { return EventType::type; }\
 								virtual const char* GetName() const override { return #type; }
 
 #define EVENT_CLASS_CATEGORY(category) virtual int GetCategoryFlags() const override { return category; }
@@ -43,7 +59,8 @@ namespace Hazel {
 
 		bool Handled = false;
 
-		virtual EventType GetEventType() const = 0;
+		// Not virtual, the type is stored in the Event itself by the subclass' constructor (passing in its GetStaticType())
+		inline EventType GetEventType() const { return m_Type; }
 		virtual const char* GetName() const = 0;
 		virtual int GetCategoryFlags() const = 0;
 
@@ -53,42 +70,78 @@ namespace Hazel {
 		inline bool IsInCategory(EventCategory category) {
 			return GetCategoryFlags() & category;
 		}
+
+	protected:
+
+		Event(EventType type)
+			: m_Type(type)
+		{}
+
+	private:
+
+		EventType m_Type;
+	};
+
+
+	// Frees an event with the size of the type it was made as, which the pool needs and Event* doesn't know. (there's no virtual
+	// destructor, events are trivially destructible, see EventQueue) Which is why Event has no operator new/delete of its own: a
+	// delete through Event* would give the pool sizeof(Event), and put the block in the wrong size class.
+	struct EventDeleter {
+
+		uint32_t Size = 0;
+
+		inline void operator()(Event* event) const { PoolAllocator::Get().Free(event, Size); }
 	};
 
+	using EventPtr = std::unique_ptr<Event, EventDeleter>;
+
+	// An event of its own, eg. MakeEvent<KeyPressedEvent>(key, 0) to hand over to another thread.
+	template<typename T, typename... Args>
+	EventPtr MakeEvent(Args&&... args) {
+
+		static_assert(std::is_base_of_v<Event, T>, "MakeEvent only makes Hazel::Event subclasses!");
+		static_assert(std::is_trivially_destructible_v<T>, "EventDeleter doesn't call destructors");
+		void* memory = PoolAllocator::Get().Allocate(sizeof(T));
+		return EventPtr(new (memory) T(std::forward<Args>(args)...), EventDeleter{ (uint32_t)sizeof(T) });
+	}
+
 
 	class EventDispatcher { // Not declared _declspec(), likely because it's intended to be exposed, and only used within Hazel.
 		// A utility class that's used to check if an event is of a particular type and dispatch it to a function that can handle that type. 
-		// This is achieved through the Dispatch template method, which takes a templated EventFn function. 
-		// If the event matches the template type T, the function is called with the event cast to that type.
-
-		template<typename T>
-		using EventFn = std::function<bool(T&)>;
-		// EventFn is a std::function instance that returns bool, and takes in T& as parameter
-		// T can be any EventType (check enum class)
+		// This is achieved through the Dispatch template method, which takes any callable (lambda, HZ_BIND_EVENT_FN, or an object + 
+		// member function pointer). If the event matches the template type T, the function is called with the event cast to that type.
+		// 
+		// Nothing here allocates or calls through a vtable: the callable is a template parameter (so it gets inlined, unlike the std::function
+		// built from std::bind that was used before), and the type check reads the EventType stored in the Event.
 
 	public:
 
-		// This instance is created every single time OnEvent() is called, which exists in the platform-specific Windows class, such as "WindowsWindow"
-		// which inherits the Window class, and exists in their WindowData class' EventCallback attribute.
-		// Each time this EventCallback is called, OnEvent(Event& e) from Application class is called, resulting in a new EventDispatcher object
-		// being created, which passes in the specific event that occur, and then multiple "Dispatch" methods will be checked against, and when true
-		// a specific handler will be called,. such as "OnWindowClose(WindowCloseEvent& e)"
+		// This instance is created every single time OnEvent() is called, which is invoked for every event drained from the Application's 
+		// EventQueue. Each time OnEvent(Event& e) is called, a new EventDispatcher object is created, which passes in the specific event that 
+		// occured, and then multiple "Dispatch" methods will be checked against, and when true a specific handler will be called, 
+		// such as "OnWindowClose(WindowCloseEvent& e)"
 		EventDispatcher(Event& event) 
 			: m_Event(event)
 		{}
 
-		template<typename T>
-		bool Dispatch(EventFn<T> func) {
+		// func is anything callable as bool(T&)
+		template<typename T, typename F>
+		bool Dispatch(const F& func) {
 			if (m_Event.GetEventType() == T::GetStaticType()) {
-				// if the event that you are trying to dispatch matches with 
-				// the parameter type (T&) of the std::Function
-				// the code will then call the EventFn<T> func function, with the event passed as parameter
-				m_Event.Handled = func(*(T*)&m_Event);
+				// if the event that you are trying to dispatch matches with the type T, the code will then call func, with the event 
+				// casted to T& passed as parameter
+				m_Event.Handled = func(static_cast<T&>(m_Event));
 				return true;
 			}
 			return false;
 		}
 
+		// eg. dispatcher.Dispatch(this, &Application::OnWindowClose), T is deduced from the member function's parameter.
+		template<typename T, typename C>
+		bool Dispatch(C* instance, bool (C::*func)(T&)) {
+			return Dispatch<T>([instance, func](T& e) { return (instance->*func)(e); });
+		}
+
 	private:
 
 		Event& m_Event;
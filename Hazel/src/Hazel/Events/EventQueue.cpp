@@ -0,0 +1,35 @@
+#include "hzpch.h"
+#include "EventQueue.h"
+
+
+namespace Hazel {
+
+	EventQueue::EventQueue(size_t capacity) {
+
+		// Both buffers are allocated up front, so a normal frame never touches the heap when queueing events.
+		m_Buffers[0].reserve(capacity);
+		m_Buffers[1].reserve(capacity);
+
+		std::fill(std::begin(m_LastSlot), std::end(m_LastSlot), -1);
+	}
+
+	EventQueue::~EventQueue() {}
+
+	std::vector<EventQueue::Slot>& EventQueue::SwapBuffers() {
+
+		std::vector<Slot>& readBuffer = m_Buffers[m_WriteIndex];
+
+		m_Stats.Capacity = (uint32_t)readBuffer.capacity();
+		m_Stats.PeakQueued = (uint32_t)readBuffer.size();
+		if (m_Stats.Overflows > 0)
+			HZ_CORE_WARN("EventQueue overflowed {0} time(s) last frame ({1} events, capacity is now {2})", m_Stats.Overflows, m_Stats.Queued, m_Stats.Capacity);
+
+		m_LastFrameStats = m_Stats;
+		m_Stats = EventQueueStats();
+
+		// From here on, anything that gets queued goes to the other buffer.
+		m_WriteIndex ^= 1;
+		std::fill(std::begin(m_LastSlot), std::end(m_LastSlot), -1);
+		return readBuffer;
+	}
+}
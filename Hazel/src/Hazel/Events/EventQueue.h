@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Hazel/Core.h"
+#include "Event.h"
+
+#include <new>
+#include <type_traits>
+
+
+namespace Hazel {
+
+	// How the EventQueue treats several events of the same EventType within one frame. Set per EventType, through SetCoalescing().
+	enum class EventCoalescing {
+		None = 0,			// every event is dispatched (default)
+		MergeConsecutive,	// an event right after one of the same type is merged into it, through T::Coalesce(next) if the event has it
+		KeepLatest			// only the last event of that type queued this frame is dispatched, (eg. WindowResize while dragging)
+	};
+
+	// Per-frame numbers for the EventQueue, reset every time the queue is drained. Capacity is the number of pre-allocated slots in
+	// the write buffer, Overflows counts how many times a burst of input forced that buffer to grow past it.
+	struct EventQueueStats {
+
+		uint32_t Queued = 0;
+		uint32_t Dispatched = 0;
+		uint32_t Capacity = 0;
+		uint32_t PeakQueued = 0;
+		uint32_t Overflows = 0;
+		uint32_t Coalesced = 0;							// events merged into/replaced by a newer one, so never dispatched
+		uint32_t CoalescedByType[EventTypeCount] = {};	// same as above, indexed by EventType
+	};
+
+
+	class HAZEL_API EventQueue {
+	// Double-buffered event bus. GLFW callbacks (through the Window) copy their events in here instead of dispatching them on the spot,
+	// and Application::Run drains everything once per frame in its own "event" stage. Events that get queued while the queue is being
+	// drained (eg. a layer reacting to an event by raising another one) land in the other buffer, and are handled next frame.
+	public:
+
+		static constexpr size_t SlotSize = 64; // big enough for every event in Events/, checked by the static_assert in Emplace()
+
+		EventQueue(size_t capacity = 256);
+		~EventQueue();
+
+		// Constructs an event of type T in place, at the back of the write buffer.
+		template<typename T, typename... Args>
+		void Emplace(Args&&... args) {
+
+			static_assert(std::is_base_of_v<Event, T>, "EventQueue only holds Hazel::Event subclasses!");
+			static_assert(sizeof(T) <= SlotSize && alignof(T) <= alignof(Slot), "Event is too big for an EventQueue slot, increase SlotSize");
+			static_assert(std::is_trivially_destructible_v<T>, "Queued events are never destructed, so they can't own any resources");
+
+			const EventType type = T::GetStaticType();
+			std::vector<Slot>& buffer = m_Buffers[m_WriteIndex];
+			m_Stats.Queued++;
+
+			switch (m_Coalescing[(size_t)type]) {
+
+				case EventCoalescing::MergeConsecutive: {
+					if (!buffer.empty() && buffer.back().Type == type && !buffer.back().Dropped) {
+						Coalesce(*reinterpret_cast<T*>(buffer.back().Data), T(std::forward<Args>(args)...));
+						CountCoalesced(type);
+						return;
+					}
+					break;
+				}
+				case EventCoalescing::KeepLatest: {
+					int32_t previous = m_LastSlot[(size_t)type];
+					if (previous >= 0) {
+						buffer[previous].Dropped = true;
+						CountCoalesced(type);
+					}
+					break;
+				}
+				default:
+					break;
+			}
+
+			if (buffer.size() == buffer.capacity())
+				m_Stats.Overflows++; // vector growth (a heap allocation) below, means the capacity was too small for this frame.
+
+			buffer.emplace_back();
+			Slot& slot = buffer.back();
+			new (slot.Data) T(std::forward<Args>(args)...);
+			slot.Type = type;
+			slot.Dropped = false;
+			m_LastSlot[(size_t)type] = (int32_t)buffer.size() - 1;
+		}
+
+		// Swaps the buffers, then calls func(Event&) for every event that was queued since the last call, in the order they arrived.
+		template<typename F>
+		void Dispatch(F&& func) {
+
+			std::vector<Slot>& buffer = SwapBuffers();
+			for (Slot& slot : buffer) {
+				if (slot.Dropped)
+					continue;
+
+				func(*reinterpret_cast<Event*>(slot.Data));
+				m_LastFrameStats.Dispatched++;
+			}
+			buffer.clear(); // keeps the capacity, so next frame's events reuse the same memory
+		}
+
+		// Coalescing is opt-in, every EventType starts as EventCoalescing::None.
+		inline void SetCoalescing(EventType type, EventCoalescing coalescing) { m_Coalescing[(size_t)type] = coalescing; }
+		inline EventCoalescing GetCoalescing(EventType type) const { return m_Coalescing[(size_t)type]; }
+
+		inline bool Empty() const { return m_Buffers[m_WriteIndex].empty(); }
+		inline size_t Size() const { return m_Buffers[m_WriteIndex].size(); }
+
+		// Stats of the frame that was last drained by Dispatch()
+		inline const EventQueueStats& GetLastFrameStats() const { return m_LastFrameStats; }
+
+	private:
+
+		struct alignas(16) Slot {
+			unsigned char Data[SlotSize];
+			EventType Type;
+			bool Dropped; // replaced by a newer event of the same type (EventCoalescing::KeepLatest), skipped by Dispatch()
+		};
+
+		// Events that have a Coalesce(const T& next) method (eg. MouseMovedEvent) get merged, anything else just keeps the newer event.
+		template<typename T, typename = void>
+		struct HasCoalesce : std::false_type {};
+		template<typename T>
+		struct HasCoalesce<T, std::void_t<decltype(std::declval<T&>().Coalesce(std::declval<const T&>()))>> : std::true_type {};
+
+		template<typename T>
+		static void Coalesce(T& previous, const T& next) {
+			if constexpr (HasCoalesce<T>::value)
+				previous.Coalesce(next);
+			else
+				previous = next;
+		}
+
+		inline void CountCoalesced(EventType type) {
+			m_Stats.Coalesced++;
+			m_Stats.CoalescedByType[(size_t)type]++;
+		}
+
+		std::vector<Slot>& SwapBuffers();
+
+	private:
+
+		std::vector<Slot> m_Buffers[2];
+		uint32_t m_WriteIndex = 0;
+
+		EventCoalescing m_Coalescing[EventTypeCount] = {};
+		int32_t m_LastSlot[EventTypeCount]; // index of the latest slot of each EventType in the write buffer, -1 if none this frame
+
+		EventQueueStats m_Stats;
+		EventQueueStats m_LastFrameStats;
+	};
+}
@@ -16,8 +16,8 @@ namespace Hazel {
 	protected:
 
 		//protected constructor, meaning this class can only be instantiated by its children classes
-		KeyEvent(int keyCode) 
-			: m_KeyCode(keyCode)
+		KeyEvent(EventType type, int keyCode) 
+			: Event(type), m_KeyCode(keyCode)
 		{}
 		int m_KeyCode;
 	};
@@ -28,7 +28,7 @@ namespace Hazel {
 	public:
 
 		KeyPressedEvent(int keyCode, int repeatCount)
-			: KeyEvent(keyCode), m_RepeatCount(repeatCount)
+			: KeyEvent(GetStaticType(), keyCode), m_RepeatCount(repeatCount)
 		{}
 
 		inline int GetRepeatCount() const { return m_RepeatCount; }
@@ -66,7 +66,7 @@ namespace Hazel {
 	public: 
 
 		KeyReleasedEvent(int keyCode)
-			: KeyEvent(keyCode) //initialising superclass
+			: KeyEvent(GetStaticType(), keyCode) //initialising superclass
 		{}
 
 		std::string ToString() const override{
@@ -85,7 +85,7 @@ namespace Hazel {
 	public:
 
 		KeyTypedEvent(int keycode)
-			: KeyEvent(keycode)
+			: KeyEvent(GetStaticType(), keycode)
 		{}
 
 		std::string ToString() const override {
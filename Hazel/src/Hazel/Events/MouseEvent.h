@@ -9,16 +9,27 @@ namespace Hazel {
 
 	public:
 
-		MouseMovedEvent(float x, float y)
-			: m_MouseX(x), m_MouseY(y)
+		MouseMovedEvent(float x, float y, float deltaX = 0.0f, float deltaY = 0.0f)
+			: Event(GetStaticType()), m_MouseX(x), m_MouseY(y), m_DeltaX(deltaX), m_DeltaY(deltaY)
 		{}
 
 		inline float GetX() const { return m_MouseX; }
 		inline float GetY() const { return m_MouseY; }
+		// Movement since the previous MouseMovedEvent. When coalesced, this is the sum of all the movements that were merged.
+		inline float GetDeltaX() const { return m_DeltaX; }
+		inline float GetDeltaY() const { return m_DeltaY; }
+
+		// Used by EventQueue coalescing, merges a newer MouseMovedEvent into this one. (latest position, accumulated delta)
+		void Coalesce(const MouseMovedEvent& next) {
+			m_MouseX = next.m_MouseX;
+			m_MouseY = next.m_MouseY;
+			m_DeltaX += next.m_DeltaX;
+			m_DeltaY += next.m_DeltaY;
+		}
 		
 		std::string ToString() const override {
 			std::stringstream ss;
-			ss << "MouseMovedEvent: " << m_MouseX << ", " << m_MouseY;
+			ss << "MouseMovedEvent: " << m_MouseX << ", " << m_MouseY << " (delta " << m_DeltaX << ", " << m_DeltaY << ")";
 			return ss.str();
 		}
 
@@ -30,6 +41,7 @@ namespace Hazel {
 	private:
 
 		float m_MouseX, m_MouseY;
+		float m_DeltaX, m_DeltaY;
 	};
 
 
@@ -38,12 +50,18 @@ namespace Hazel {
 	public:
 
 		MouseScrolledEvent(float xOffset, float yOffset)
-			: m_XOffset(xOffset), m_YOffset(yOffset)
+			: Event(GetStaticType()), m_XOffset(xOffset), m_YOffset(yOffset)
 		{}
 
 		inline float GetXOffset() const { return m_XOffset; }
 		inline float GetYOffset() const { return m_YOffset; }
 
+		// Used by EventQueue coalescing, merges a newer MouseScrolledEvent into this one by summing the offsets.
+		void Coalesce(const MouseScrolledEvent& next) {
+			m_XOffset += next.m_XOffset;
+			m_YOffset += next.m_YOffset;
+		}
+
 		std::string ToString() const override {
 			std::stringstream ss;
 			ss << "MouseScrolledEvent: " << GetXOffset() << ", " << GetYOffset();
@@ -71,8 +89,8 @@ namespace Hazel {
 	protected:
 
 		//protected constructor, meaning this class can only be instantiated by its children classes
-		MouseButtonEvent(int button)
-			: m_Button(button) 
+		MouseButtonEvent(EventType type, int button)
+			: Event(type), m_Button(button) 
 		{}
 
 		int m_Button;
@@ -84,7 +102,7 @@ namespace Hazel {
 	public:
 
 		MouseButtonPressedEvent(int button)
-			: MouseButtonEvent(button) //initialising superclass
+			: MouseButtonEvent(GetStaticType(), button) //initialising superclass
 		{}
 
 		std::string ToString() const override {
@@ -102,7 +120,7 @@ namespace Hazel {
 	
 	public:
 		MouseButtonReleasedEvent(int button)
-			: MouseButtonEvent(button) //initialising superclass
+			: MouseButtonEvent(GetStaticType(), button) //initialising superclass
 		{}
 
 		std::string ToString() const override {
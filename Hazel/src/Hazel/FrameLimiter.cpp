@@ -0,0 +1,117 @@
+#include "hzpch.h"
+#include "FrameLimiter.h"
+
+#include <cmath>
+#include <thread>
+
+#ifdef HZ_PLATFORM_WINDOWS
+	#include <timeapi.h>
+#endif
+
+
+namespace Hazel {
+
+	FrameLimiter::FrameLimiter() {
+
+#ifdef HZ_PLATFORM_WINDOWS
+		// The default Windows timer resolution is ~15.6ms, which makes Sleep() useless for frame pacing. Asks for 1ms for as long as we're alive.
+		timeBeginPeriod(1);
+#endif
+		m_LastFrame = Clock::now();
+	}
+
+	FrameLimiter::~FrameLimiter() {
+
+#ifdef HZ_PLATFORM_WINDOWS
+		timeEndPeriod(1);
+#endif
+	}
+
+	void FrameLimiter::SetTargetFrameRate(float framesPerSecond) {
+
+		m_TargetFrameRate = framesPerSecond > 0.0f ? framesPerSecond : Uncapped;
+		m_FrameDuration = m_TargetFrameRate > 0.0f 
+			? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / m_TargetFrameRate)) 
+			: Clock::duration::zero();
+
+		m_NextDeadline = Clock::now() + m_FrameDuration;
+		m_Stats = FrameLimiterStats();
+		m_Stats.TargetFrameTime = m_TargetFrameRate > 0.0f ? 1000.0f / m_TargetFrameRate : 0.0f;
+		m_FrameCount = 0;
+	}
+
+	void FrameLimiter::Wait() {
+
+		HZ_PROFILE_FUNCTION();
+
+		if (m_TargetFrameRate == Uncapped) {
+			RecordFrame(Clock::now());
+			return;
+		}
+
+		Clock::time_point now = Clock::now();
+		if (now > m_NextDeadline) {
+
+			// Already late. Starts a new grid from here rather than rushing through the next frames to catch up.
+			m_Stats.MissedDeadlines++;
+			m_NextDeadline = now;
+		}
+		else {
+			SleepUntil(m_NextDeadline);
+		}
+
+		RecordFrame(Clock::now());
+		m_NextDeadline += m_FrameDuration;
+	}
+
+	void FrameLimiter::SleepUntil(Clock::time_point deadline) {
+
+		// Coarse part: 1ms sleeps, as long as the remaining time is larger than what a sleep is expected to take (mean + 1 standard deviation)
+		double remaining = std::chrono::duration<double>(deadline - Clock::now()).count();
+		while (remaining > m_SleepEstimate) {
+
+			Clock::time_point start = Clock::now();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			double observed = std::chrono::duration<double>(Clock::now() - start).count();
+
+			m_SleepCount++;
+			double delta = observed - m_SleepMean;
+			m_SleepMean += delta / m_SleepCount;
+			m_SleepM2 += delta * (observed - m_SleepMean);
+			m_SleepEstimate = m_SleepMean + std::sqrt(m_SleepM2 / (m_SleepCount - 1));
+
+			remaining = std::chrono::duration<double>(deadline - Clock::now()).count();
+		}
+
+		// Fine part: spins for the last stretch, to land within tens of microseconds of the deadline.
+		while (Clock::now() < deadline)
+			std::this_thread::yield();
+	}
+
+	void FrameLimiter::RecordFrame(Clock::time_point now) {
+
+		float frameTime = std::chrono::duration<float, std::milli>(now - m_LastFrame).count();
+		m_LastFrame = now;
+
+		m_FrameTimes[m_FrameIndex] = frameTime;
+		m_FrameIndex = (m_FrameIndex + 1) % HistorySize;
+		m_FrameCount = std::min(m_FrameCount + 1, HistorySize);
+
+		float sum = 0.0f;
+		for (size_t i = 0; i < m_FrameCount; i++)
+			sum += m_FrameTimes[i];
+		float average = sum / m_FrameCount;
+
+		float reference = m_Stats.TargetFrameTime > 0.0f ? m_Stats.TargetFrameTime : average;
+		float variance = 0.0f;
+		float maxDeviation = 0.0f;
+		for (size_t i = 0; i < m_FrameCount; i++) {
+			variance += (m_FrameTimes[i] - average) * (m_FrameTimes[i] - average);
+			maxDeviation = std::max(maxDeviation, std::abs(m_FrameTimes[i] - reference));
+		}
+
+		m_Stats.AverageFrameTime = average;
+		m_Stats.Jitter = std::sqrt(variance / m_FrameCount);
+		m_Stats.MaxDeviation = maxDeviation;
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Hazel/Core.h"
+
+#include <chrono>
+
+
+namespace Hazel {
+
+	// Achieved frame pacing, over the last FrameLimiter::HistorySize frames. All times are in milliseconds.
+	struct FrameLimiterStats {
+
+		float TargetFrameTime = 0.0f;	// 0 when uncapped
+		float AverageFrameTime = 0.0f;
+		float Jitter = 0.0f;			// standard deviation of the frame time
+		float MaxDeviation = 0.0f;		// worst frame, compared to the target (or the average when uncapped)
+		uint64_t MissedDeadlines = 0;	// frames that were already late before the limiter got to wait, since the target was set
+	};
+
+
+	class HAZEL_API FrameLimiter {
+	// Caps the frame rate by waiting until the next frame's deadline, which is kept on a fixed grid (deadline += frame time) so that small
+	// errors don't accumulate. OS sleeps are too coarse to hit a deadline on their own (a 1ms sleep can easily take 1-2ms), so the limiter 
+	// sleeps in short chunks while there's comfortably enough time left, using a running estimate of how long a sleep really takes, and
+	// then spins for the last stretch.
+	public:
+
+		static constexpr float Uncapped = 0.0f;
+		static constexpr float MatchRefresh = -1.0f; // resolved by Application::SetTargetFrameRate(), using the monitor's refresh rate
+
+		static constexpr size_t HistorySize = 120;
+
+		FrameLimiter();
+		~FrameLimiter();
+
+		void SetTargetFrameRate(float framesPerSecond);
+		inline float GetTargetFrameRate() const { return m_TargetFrameRate; }
+
+		// Called once per frame, blocks until the frame's deadline. (returns immediately when uncapped, but still records frame times)
+		void Wait();
+
+		inline const FrameLimiterStats& GetStats() const { return m_Stats; }
+
+	private:
+
+		void SleepUntil(std::chrono::steady_clock::time_point deadline);
+		void RecordFrame(std::chrono::steady_clock::time_point now);
+
+	private:
+
+		using Clock = std::chrono::steady_clock;
+
+		float m_TargetFrameRate = Uncapped;
+		Clock::duration m_FrameDuration = Clock::duration::zero();
+		Clock::time_point m_NextDeadline;
+		Clock::time_point m_LastFrame;
+
+		// Running mean/variance (Welford's algorithm) of how long a 1ms sleep actually takes, in seconds.
+		double m_SleepEstimate = 0.005;
+		double m_SleepMean = 0.005;
+		double m_SleepM2 = 0.0;
+		uint64_t m_SleepCount = 1;
+
+		float m_FrameTimes[HistorySize] = {};
+		size_t m_FrameIndex = 0;
+		size_t m_FrameCount = 0;
+
+		FrameLimiterStats m_Stats;
+	};
+}
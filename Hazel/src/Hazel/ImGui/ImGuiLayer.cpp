@@ -6,6 +6,16 @@
 #include "backends/imgui_impl_opengl3.h"
 
 #include "Hazel/Application.h"
+#include "Hazel/Jobs/JobSystem.h"
+#include "Hazel/Memory/AllocationTracker.h"
+#include "Hazel/Memory/FrameAllocator.h"
+#include "Hazel/Memory/PoolAllocator.h"
+#include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/RenderThread.h"
+
+#include "Platform/OpenGL/OpenGLGPUProfiler.h"
+#include "Platform/OpenGL/OpenGLShaderCache.h"
+#include "Platform/OpenGL/OpenGLStateCache.h"
 
 // TEMPORARY
 #include <GLFW/glfw3.h> // don't forget to remove the header file variant too. 
@@ -16,27 +26,77 @@ namespace Hazel {
 
 	// ImGuiKey ImGui_KeyToImGuiKey(int key); // function declaration, needed to convert GLFW keycode to imGUI keycode
 
+	// A frame's ImGui draw data, with its own copy of the draw lists.
+	struct ImGuiDrawSnapshot {
+
+		ImDrawData Data;
+		std::vector<ImDrawList*> Lists;
+
+		ImGuiDrawSnapshot(const ImDrawData* drawData)
+			: Data(*drawData)
+		{
+			for (int i = 0; i < drawData->CmdListsCount; i++)
+				Lists.push_back(drawData->CmdLists[i]->CloneOutput());
+
+#if IMGUI_VERSION_NUM >= 18973
+			for (int i = 0; i < drawData->CmdListsCount; i++)
+				Data.CmdLists[i] = Lists[i]; // CmdLists is an ImVector of its own since 1.89.8, copied along with the rest
+#else
+			Data.CmdLists = Lists.data();
+#endif
+		}
+
+		~ImGuiDrawSnapshot() {
+			for (ImDrawList* list : Lists)
+				IM_DELETE(list);
+		}
+	};
+
+
 	ImGuiLayer::ImGuiLayer() 
 		: Layer("ImGuiLayer")
-	{}
+	{
+		// ImGui gets its input straight from its own GLFW callbacks, so this layer doesn't need any Hazel events.
+		SetEventSubscription(0);
+	}
 
 	ImGuiLayer::~ImGuiLayer() {}
 	
 	void ImGuiLayer::OnAttach() {
 
-		const char* glsl_version = "#version 460"; // ROG G16 has OpenGL version 4.60
+		HZ_PROFILE_FUNCTION();
+
+		// Matches the context's GL version, "#version 460" on the ROG G16. (OpenGL 4.60) Headless Linux contexts are often older, and
+		// below 3.3 the GLSL version doesn't follow the GL one, so ImGui picks its own default there. (nullptr)
+		GLint majorVersion = 4, minorVersion = 6;
+		RenderThread::Get().SubmitAndWait([&]() {
+			glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+			glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+		});
+		char glslVersionBuffer[32];
+		snprintf(glslVersionBuffer, sizeof(glslVersionBuffer), "#version %d%d0", majorVersion, minorVersion);
+		const char* glsl_version = (majorVersion > 3 || (majorVersion == 3 && minorVersion >= 3)) ? glslVersionBuffer : nullptr;
 		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
 		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
 		//glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);  // 3.2+ only
 		//glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);            // 3.0+ only
 
 		IMGUI_CHECKVERSION();
+#ifdef HZ_ENABLE_ALLOCATION_TRACKING
+		// ImGui allocates with malloc() by default, which the AllocationTracker never sees. Has to be set before the context exists.
+		ImGui::SetAllocatorFunctions(
+			[](size_t size, void*) { return HZ_ALLOCATION_TAGGED(ImGui, ::operator new(size, std::nothrow)); },
+			[](void* memory, void*) { ::operator delete(memory); });
+#endif
 		ImGui::CreateContext();
 		ImGuiIO& io = ImGui::GetIO(); (void)io;
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
 		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;         // Enable Docking
-		io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;       // Enable Multi-Viewport / Platform Windows
+		// Multi-Viewport / Platform Windows: no desktop to put them on when headless. Not with a render thread either, since every extra
+		// window brings its own context, made current and swapped by ImGui from the main thread.
+		if (!Application::Get().GetWindow().IsHeadless() && !RenderThread::Get().IsRunning())
+			io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
 		//io.ConfigViewportsNoAutoMerge = true;
 		//io.ConfigViewportsNoTaskBarIcon = true;
 
@@ -57,46 +117,323 @@ namespace Hazel {
 
 		// Setup Platform/Renderer backends
 		ImGui_ImplGlfw_InitForOpenGL(window, true);
-		ImGui_ImplOpenGL3_Init(glsl_version);
+		// The backend's shaders and the font texture (which builds the font atlas) are created here, while the main thread waits, rather
+		// than lazily by the first ImGui_ImplOpenGL3_NewFrame(). On the render thread that would run after the main thread's first
+		// ImGui::NewFrame(), which needs the atlas built, and would build it on one thread while the other reads it.
+		RenderThread::Get().SubmitAndWait([&]() {
+			ImGui_ImplOpenGL3_Init(glsl_version);
+			ImGui_ImplOpenGL3_CreateDeviceObjects();
+		});
 	}
 
 	void ImGuiLayer::OnDetach() {
 	
-		ImGui_ImplOpenGL3_Shutdown();
+		RenderThread::Get().SubmitAndWait([]() { ImGui_ImplOpenGL3_Shutdown(); });
 		ImGui_ImplGlfw_Shutdown();
 		ImGui::DestroyContext();
 	}
 
 	void ImGuiLayer::Begin() {
 
-		ImGui_ImplOpenGL3_NewFrame();
+		HZ_PROFILE_FUNCTION();
+
+		// Nothing left to do on the GL side, OnAttach() created the backend's objects already. Still called, on the render thread, in
+		// case a backend version does more per frame.
+		RenderThread::Get().Submit([]() { ImGui_ImplOpenGL3_NewFrame(); });
 		ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();
 	}
 
 	void ImGuiLayer::End() {
 
+		HZ_PROFILE_FUNCTION();
+
 		ImGuiIO& io = ImGui::GetIO();
 		Application& app = Application::Get();
 		io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
 
 		// Rendering
-		ImGui::Render();
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		{
+			HZ_PROFILE_SCOPE("ImGui::Render");
+			ImGui::Render();
+
+			HZ_PROFILE_GPU_SCOPE("ImGui RenderDrawData");
+			if (RenderThread::Get().IsRunning()) {
+				// ImGui reuses its draw lists next frame, long before the render thread gets to this one, so it draws a copy of them.
+				RenderThread::Get().Submit([snapshot = std::make_shared<ImGuiDrawSnapshot>(ImGui::GetDrawData())]() {
+					ImGui_ImplOpenGL3_RenderDrawData(&snapshot->Data);
+					OpenGLStateCache::Get().Invalidate();
+				});
+			}
+			else {
+				ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+				// Sets its own program, textures, blend state etc. behind the state cache's back.
+				OpenGLStateCache::Get().Invalidate();
+			}
+		}
+
+		// In render on demand mode, keeps frames coming while the user is interacting with a widget (dragging a slider, typing, etc.)
+		// Layers with their own animations can do the same, by calling Application::RequestRedraw() from OnImGuiRender().
+		if (ImGui::IsAnyItemActive())
+			app.RequestRedraw();
 
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
 
+			HZ_PROFILE_SCOPE("ImGui::RenderPlatformWindowsDefault");
+			// The extra viewports render with their own contexts. The queries belong to the main context, and are issued before it 
+			// switches over and after it's back, so this is the main context's view of that time rather than the viewports' own GPU work.
+			HZ_PROFILE_GPU_SCOPE("ImGui RenderPlatformWindowsDefault");
+
 			GLFWwindow* backup_current_context = glfwGetCurrentContext();
 			ImGui::UpdatePlatformWindows();
 			ImGui::RenderPlatformWindowsDefault();
 			glfwMakeContextCurrent(backup_current_context);
+			OpenGLStateCache::Get().Invalidate();
 		}
 	}
 
 	void ImGuiLayer::OnImGuiRender() {
 
-		static bool show = true;
-		ImGui::ShowDemoWindow(&show);
+		if (m_ShowDemoWindow)
+			ImGui::ShowDemoWindow(&m_ShowDemoWindow);
+
+		if (m_ShowPerformancePanel)
+			DrawPerformancePanel();
+
+		if (m_ShowMemoryPanel)
+			DrawMemoryPanel();
+	}
+
+	// One row of the timings tables: label, then min/avg/p95/p99/max in milliseconds.
+	static void TimingRow(const char* label, const TimingHistory& history) {
+
+		TimingSummary summary = history.Summarize();
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn(); ImGui::TextUnformatted(label);
+		ImGui::TableNextColumn(); ImGui::Text("%.3f", summary.Min);
+		ImGui::TableNextColumn(); ImGui::Text("%.3f", summary.Average);
+		ImGui::TableNextColumn(); ImGui::Text("%.3f", summary.P95);
+		ImGui::TableNextColumn(); ImGui::Text("%.3f", summary.P99);
+		ImGui::TableNextColumn(); ImGui::Text("%.3f", summary.Max);
+	}
+
+	static bool BeginTimingTable(const char* id, const char* firstColumn) {
+
+		if (!ImGui::BeginTable(id, 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp))
+			return false;
+
+		ImGui::TableSetupColumn(firstColumn, ImGuiTableColumnFlags_WidthStretch, 2.0f);
+		ImGui::TableSetupColumn("min");
+		ImGui::TableSetupColumn("avg");
+		ImGui::TableSetupColumn("p95");
+		ImGui::TableSetupColumn("p99");
+		ImGui::TableSetupColumn("max");
+		ImGui::TableHeadersRow();
+		return true;
+	}
+
+	void ImGuiLayer::DrawPerformancePanel() {
+
+		const FrameStats& stats = Application::Get().GetFrameStats();
+		const TimingHistory& frames = stats.GetFrameHistory();
+
+		if (!ImGui::Begin("Performance", &m_ShowPerformancePanel)) {
+			ImGui::End();
+			return;
+		}
+
+		TimingSummary frameSummary = frames.Summarize();
+		ImGui::Text("Frame: %.3f ms (%.1f fps avg), last %zu frames", frames.GetLatest(), 
+			frameSummary.Average > 0.0f ? 1000.0f / frameSummary.Average : 0.0f, frames.GetCount());
+
+		char overlay[64];
+		snprintf(overlay, sizeof(overlay), "avg %.2f ms  p99 %.2f ms", frameSummary.Average, frameSummary.P99);
+		ImGui::PlotLines("##FrameTimes", frames.GetSamples(), (int)frames.GetCount(), (int)frames.GetOffset(), overlay, 
+			0.0f, frameSummary.Max * 1.1f, ImVec2(-1.0f, 80.0f));
+
+		// All times in milliseconds
+		if (ImGui::CollapsingHeader("Stages", ImGuiTreeNodeFlags_DefaultOpen) && BeginTimingTable("##Stages", "stage (ms)")) {
+
+			TimingRow("Frame", frames);
+			for (int i = 0; i < (int)FrameStage::Count; i++)
+				TimingRow(FrameStageToString((FrameStage)i), stats.GetStageHistory((FrameStage)i));
+
+			ImGui::EndTable();
+		}
+
+		if (ImGui::CollapsingHeader("Layers", ImGuiTreeNodeFlags_DefaultOpen) && BeginTimingTable("##Layers", "layer (ms)")) {
+
+			// The labels are rebuilt every frame the panel is open, two per layer, from frame memory rather than the heap.
+			FrameString label;
+			for (const LayerTimings& layer : stats.GetLayerTimings()) {
+
+				ImGui::PushID(layer.Name.c_str());
+				label.assign(layer.Name.data(), layer.Name.size()).append(" OnUpdate");
+				TimingRow(label.c_str(), layer.Update);
+				label.assign(layer.Name.data(), layer.Name.size()).append(" OnImGuiRender");
+				TimingRow(label.c_str(), layer.ImGuiRender);
+				ImGui::PopID();
+			}
+
+			ImGui::EndTable();
+		}
+
+		OpenGLGPUProfiler& gpuProfiler = OpenGLGPUProfiler::Get();
+		if (ImGui::CollapsingHeader("GPU", ImGuiTreeNodeFlags_DefaultOpen)) {
+
+			if (!gpuProfiler.IsSupported()) {
+				ImGui::TextDisabled("No timer queries on this OpenGL context.");
+			}
+			else if (BeginTimingTable("##GPU", "gpu scope (ms)")) {
+
+				// Results lag FrameLatency frames behind, that's the price of never stalling on the GPU.
+				for (const GPUScopeTimings& scope : gpuProfiler.GetScopeTimings())
+					TimingRow(scope.Name, scope.History);
+
+				ImGui::EndTable();
+				ImGui::Text("Skipped frames (GPU too far behind): %llu", (unsigned long long)gpuProfiler.GetSkippedFrames());
+			}
+		}
+
+		if (ImGui::CollapsingHeader("Render queue")) {
+
+			const RenderQueueStats& stats = Renderer::GetQueueStats();
+			ImGui::Text("Packets: %u", stats.Packets);
+			ImGui::Text("Binds: %u shader, %u texture, %u vertex array, %u blend", stats.ShaderBinds, stats.TextureBinds, 
+				stats.VertexArrayChanges, stats.BlendChanges);
+			ImGui::Text("Binds avoided by sorting: %u (of %u)", stats.BindsAvoided, stats.SubmissionOrderBinds);
+		}
+
+		if (RenderThread::Get().IsRunning() && ImGui::CollapsingHeader("Render thread")) {
+
+			RenderThreadStats stats = RenderThread::Get().GetStats();
+			ImGui::Text("Frames in flight: %u", RenderThread::Get().GetFramesInFlight());
+			ImGui::Text("Last frame: %u commands, %.1f KB", stats.Commands, stats.Bytes / 1024.0f);
+			ImGui::Text("Render thread executing: %.3f ms", stats.ExecuteMilliseconds);
+			ImGui::Text("Main thread waiting on it: %.3f ms", stats.WaitMilliseconds);
+		}
+
+		if (ImGui::CollapsingHeader("Job system")) {
+
+			JobSystemStats stats = JobSystem::Get().GetStats();
+			ImGui::Text("Threads: %u (main thread included)", stats.Threads);
+			ImGui::Text("Jobs run: %llu, stolen: %llu", (unsigned long long)stats.Executed, (unsigned long long)stats.Stolen);
+		}
+
+		if (ImGui::CollapsingHeader("OpenGL state cache")) {
+
+			// Last frame's, the current one is still being counted.
+			OpenGLStateCacheStats stats = OpenGLStateCache::Get().GetLastFrameStats();
+			ImGui::Text("Binds/state changes issued: %llu", (unsigned long long)stats.Issued);
+			ImGui::Text("Redundant ones elided: %llu", (unsigned long long)stats.Elided);
+		}
+
+		if (ImGui::CollapsingHeader("Frame allocator")) {
+
+			FrameAllocatorStats stats = FrameAllocator::Get().GetStats();
+			ImGui::Text("Last frame: %u allocations, %.1f KB", stats.Allocations, stats.Used / 1024.0f);
+			ImGui::Text("High-water mark: %.1f KB (of %.1f KB, both frames)", stats.HighWater / 1024.0f, stats.Capacity / 1024.0f);
+			ImGui::Text("Blocks added after running out: %u", stats.Overflows);
+		}
+
+		if (ImGui::CollapsingHeader("Shader cache")) {
+
+			OpenGLShaderCacheStats stats = OpenGLShaderCache::Get().GetStats();
+			if (!OpenGLShaderCache::Get().IsSupported())
+				ImGui::TextDisabled("No program binaries on this OpenGL context.");
+			ImGui::Text("Loaded from binaries: %u (%.1f ms)", stats.Hits, stats.HitMilliseconds);
+			ImGui::Text("Compiled from source: %u (%.1f ms)", stats.Misses, stats.CompileMilliseconds);
+			ImGui::Text("Binaries rejected by the driver: %u", stats.Rejected);
+		}
+
+		ImGui::End();
+	}
+
+	void ImGuiLayer::DrawMemoryPanel() {
+
+		if (!ImGui::Begin("Memory", &m_ShowMemoryPanel)) {
+			ImGui::End();
+			return;
+		}
+
+		DrawPoolTable();
+
+		if (!AllocationTracker::IsCompiledIn()) {
+			ImGui::TextDisabled("Allocation tracking is compiled out of this build.");
+			ImGui::End();
+			return;
+		}
+
+		bool enabled = AllocationTracker::IsEnabled();
+		if (ImGui::Checkbox("Track allocations", &enabled))
+			AllocationTracker::SetEnabled(enabled);
+		ImGui::SameLine();
+		if (ImGui::Button("Dump to file"))
+			AllocationTracker::Dump("allocations.txt");
+
+		int budget = (int)AllocationTracker::GetFrameBudget();
+		if (ImGui::InputInt("Allocations per frame budget (-1 for none)", &budget))
+			AllocationTracker::SetFrameBudget(budget < -1 ? -1 : budget);
+
+		// Last frame's, and live only counts what was allocated while tracking was on.
+		AllocationStats stats = AllocationTracker::GetStats();
+		ImGui::Text("Live: %.1f KB, peak %.1f KB", stats.Total.LiveBytes / 1024.0f, stats.PeakLiveBytes / 1024.0f);
+		ImGui::Text("Frames over budget: %llu (of %llu)", (unsigned long long)stats.FramesOverBudget, (unsigned long long)stats.Frames);
+
+		if (ImGui::BeginTable("##Allocations", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp)) {
+
+			ImGui::TableSetupColumn("tag", ImGuiTableColumnFlags_WidthStretch, 1.5f);
+			ImGui::TableSetupColumn("allocs/frame");
+			ImGui::TableSetupColumn("KB/frame");
+			ImGui::TableSetupColumn("live allocs");
+			ImGui::TableSetupColumn("live KB");
+			ImGui::TableHeadersRow();
+
+			auto row = [](const char* name, const AllocationTagStats& tag) {
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn(); ImGui::TextUnformatted(name);
+				ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)tag.FrameAllocations);
+				ImGui::TableNextColumn(); ImGui::Text("%.1f", tag.FrameBytes / 1024.0f);
+				ImGui::TableNextColumn(); ImGui::Text("%lld", (long long)tag.LiveAllocations);
+				ImGui::TableNextColumn(); ImGui::Text("%.1f", tag.LiveBytes / 1024.0f);
+			};
+
+			for (size_t i = 0; i < AllocationTagCount; i++)
+				row(AllocationTagToString((AllocationTag)i), stats.Tags[i]);
+			row("Total", stats.Total);
+
+			ImGui::EndTable();
+		}
+
+		ImGui::End();
+	}
+
+	void ImGuiLayer::DrawPoolTable() {
+
+		if (!ImGui::CollapsingHeader("Pools", ImGuiTreeNodeFlags_DefaultOpen))
+			return;
+
+		if (ImGui::BeginTable("##Pools", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp)) {
+
+			ImGui::TableSetupColumn("block size", ImGuiTableColumnFlags_WidthStretch, 1.5f);
+			ImGui::TableSetupColumn("used");
+			ImGui::TableSetupColumn("capacity");
+			ImGui::TableSetupColumn("KB");
+			ImGui::TableHeadersRow();
+
+			for (uint32_t i = 0; i < PoolAllocator::SizeClassCount; i++) {
+
+				PoolStats pool = PoolAllocator::Get().GetStats(i);
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn(); ImGui::Text("%u B", pool.BlockSize);
+				ImGui::TableNextColumn(); ImGui::Text("%u", pool.Used);
+				ImGui::TableNextColumn(); ImGui::Text("%u", pool.Capacity);
+				ImGui::TableNextColumn(); ImGui::Text("%.1f", pool.Chunks * (BlockPool::ChunkSize / 1024.0f));
+			}
+
+			ImGui::EndTable();
+		}
 	}
 
 	// Redacted - Not needed for now, if ever
@@ -22,10 +22,25 @@ namespace Hazel {
 		
 		void Begin();
 		void End();
+
+		inline void SetPerformancePanelVisible(bool visible) { m_ShowPerformancePanel = visible; }
+		inline void SetMemoryPanelVisible(bool visible) { m_ShowMemoryPanel = visible; }
 		
+	private:
+
+		// Frame time graph and per stage / per layer timings, from Application::GetFrameStats()
+		void DrawPerformancePanel();
+		// Heap allocations per AllocationTag, from the AllocationTracker
+		void DrawMemoryPanel();
+		// Blocks used per PoolAllocator size class, in the memory panel
+		void DrawPoolTable();
+
 	private:
 
 		float m_Time = 0.0f;
+		bool m_ShowDemoWindow = true;
+		bool m_ShowPerformancePanel = true;
+		bool m_ShowMemoryPanel = true;
 	};
 };
 
@@ -0,0 +1,300 @@
+#include "hzpch.h"
+#include "JobSystem.h"
+
+
+namespace Hazel {
+
+	// JobDeque --------------------------------------------------------------------------------------------------------------------------
+	// The memory orders are the ones from "Correct and Efficient Work-Stealing for Weak Memory Models", (Lê et al., 2013) but for
+	// Push(), which publishes with a release store rather than a release fence.
+
+	bool JobDeque::Push(Job* job) {
+
+		int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+		int64_t top = m_Top.load(std::memory_order_acquire);
+		if (bottom - top >= (int64_t)Capacity)
+			return false;
+
+		m_Jobs[bottom & (Capacity - 1)].store(job, std::memory_order_relaxed);
+		m_Bottom.store(bottom + 1, std::memory_order_release); // the job, (and what it captured) for the thief that sees the new bottom
+		return true;
+	}
+
+	Job* JobDeque::Pop() {
+
+		int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+		m_Bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t top = m_Top.load(std::memory_order_relaxed);
+
+		if (top > bottom) {
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		Job* job = m_Jobs[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+		if (top == bottom) {
+			// The last one, a thief may be taking it at the same time, whoever moves the top first gets it.
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				job = nullptr;
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+		return job;
+	}
+
+	Job* JobDeque::Steal() {
+
+		int64_t top = m_Top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+		if (top >= bottom)
+			return nullptr;
+
+		Job* job = m_Jobs[top & (Capacity - 1)].load(std::memory_order_relaxed);
+		if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return nullptr; // lost to the owner, or another thief
+		return job;
+	}
+
+	// JobSystem -------------------------------------------------------------------------------------------------------------------------
+
+	static thread_local int32_t t_WorkerIndex = -1;
+	static thread_local Job* t_CurrentJob = nullptr;
+
+	// Where thieves start looking, so they don't all go for the same worker. (xorshift)
+	static uint32_t NextVictim(uint32_t workerCount) {
+
+		static thread_local uint32_t state = (uint32_t)std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state % workerCount;
+	}
+
+	JobSystem& JobSystem::Get() {
+
+		static JobSystem instance;
+		return instance;
+	}
+
+	JobSystem::~JobSystem() {
+		Stop();
+	}
+
+	Job* JobSystem::GetCurrentJob() {
+		return t_CurrentJob;
+	}
+
+	void JobSystem::Start(uint32_t threadCount) {
+
+		HZ_CORE_ASSERT(!m_Running, "Job system already running!");
+		HZ_CORE_ASSERT(t_WorkerIndex == -1, "This thread already belongs to a job system!");
+
+		if (threadCount == 0)
+			threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+		m_Stopping = false;
+		m_OwnerID = std::this_thread::get_id();
+		m_Workers.clear();
+		for (uint32_t i = 0; i < threadCount; i++)
+			m_Workers.push_back(std::make_unique<Worker>());
+
+		t_WorkerIndex = 0;
+		m_Running = true;
+		for (uint32_t i = 1; i < threadCount; i++)
+			m_Workers[i]->Thread = std::thread(&JobSystem::WorkerMain, this, i);
+
+		HZ_CORE_INFO("Job system started, {0} thread(s)", threadCount);
+	}
+
+	void JobSystem::Stop() {
+
+		if (!m_Running)
+			return;
+
+		HZ_CORE_ASSERT(std::this_thread::get_id() == m_OwnerID, "The job system has to be stopped by the thread that started it!");
+
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_Stopping = true;
+		}
+		m_WakeUp.notify_all();
+		for (uint32_t i = 1; i < m_Workers.size(); i++)
+			m_Workers[i]->Thread.join();
+
+		// Whatever is left still runs, nobody may be waiting on it, but it can't be left hanging either.
+		while (Job* job = GetJob(0))
+			Execute(job);
+
+		t_WorkerIndex = -1;
+		m_Running = false;
+		m_Workers.clear();
+	}
+
+	void JobSystem::Schedule(Job* job) {
+
+		if (!m_Running) {
+			Execute(job);
+			return;
+		}
+
+		int32_t workerIndex = t_WorkerIndex;
+		if (workerIndex >= 0) {
+			// Full, it's run straight away instead. Still correct, just less parallel.
+			if (!m_Workers[workerIndex]->Deque.Push(job)) {
+				Execute(job);
+				return;
+			}
+		}
+		else {
+			std::lock_guard<std::mutex> lock(m_SharedMutex);
+			m_SharedJobs.push_back(job);
+			m_SharedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// Pairs with the fence in WorkerMain(): either the worker going to sleep sees the job, or this sees it going to sleep.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (m_Sleeping.load(std::memory_order_relaxed) > 0) {
+			{ std::lock_guard<std::mutex> lock(m_SleepMutex); }
+			m_WakeUp.notify_one();
+		}
+	}
+
+	void JobSystem::Execute(Job* job) {
+
+		Job* previous = t_CurrentJob;
+		t_CurrentJob = job;
+		{
+			ScopedAllocationTag tag(job->Tag);
+			job->Invoke(job->Closure);
+		}
+		t_CurrentJob = previous;
+
+		if (m_Running && t_WorkerIndex >= 0)
+			m_Workers[t_WorkerIndex]->Executed.fetch_add(1, std::memory_order_relaxed);
+
+		Finish(job);
+	}
+
+	void JobSystem::Finish(Job* job) {
+
+		// The last of the job and its children to finish takes care of the parent, and nothing refers to the job after that.
+		while (job && job->Unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+
+			Job* parent = job->Parent;
+			JobCounter* counter = job->Counter;
+			delete job;
+
+			if (counter)
+				counter->m_Count.fetch_sub(1, std::memory_order_release);
+			job = parent;
+		}
+	}
+
+	void JobSystem::Wait(JobCounter& counter) {
+
+		HZ_PROFILE_FUNCTION();
+
+		int32_t workerIndex = m_Running ? t_WorkerIndex : -1;
+		while (!counter.IsDone()) {
+
+			if (Job* job = m_Running ? GetJob(workerIndex) : nullptr)
+				Execute(job);
+			else
+				std::this_thread::yield(); // the rest of it is running on other threads
+		}
+	}
+
+	Job* JobSystem::GetJob(int32_t workerIndex) {
+
+		if (workerIndex >= 0) {
+			if (Job* job = m_Workers[workerIndex]->Deque.Pop())
+				return job;
+		}
+
+		if (m_SharedCount.load(std::memory_order_relaxed) > 0) {
+
+			std::lock_guard<std::mutex> lock(m_SharedMutex);
+			if (!m_SharedJobs.empty()) {
+				Job* job = m_SharedJobs.front();
+				m_SharedJobs.pop_front();
+				m_SharedCount.fetch_sub(1, std::memory_order_relaxed);
+				return job;
+			}
+		}
+
+		uint32_t workerCount = (uint32_t)m_Workers.size();
+		uint32_t victim = NextVictim(workerCount);
+		for (uint32_t i = 0; i < workerCount; i++, victim = (victim + 1) % workerCount) {
+
+			if ((int32_t)victim == workerIndex)
+				continue;
+			if (Job* job = m_Workers[victim]->Deque.Steal()) {
+				if (workerIndex >= 0)
+					m_Workers[workerIndex]->Stolen.fetch_add(1, std::memory_order_relaxed);
+				return job;
+			}
+		}
+		return nullptr;
+	}
+
+	bool JobSystem::HasJobs() const {
+
+		if (m_SharedCount.load(std::memory_order_relaxed) > 0)
+			return true;
+		for (const std::unique_ptr<Worker>& worker : m_Workers) {
+			if (!worker->Deque.IsEmpty())
+				return true;
+		}
+		return false;
+	}
+
+	void JobSystem::WorkerMain(uint32_t workerIndex) {
+
+		t_WorkerIndex = (int32_t)workerIndex;
+
+		// Spins for a little while after running out of jobs, since more usually follow shortly, (the next ParallelFor of the frame)
+		// then sleeps until Schedule() or Stop() wakes it up.
+		constexpr uint32_t spinsBeforeSleeping = 256;
+		uint32_t spins = 0;
+
+		for (;;) {
+
+			if (Job* job = GetJob((int32_t)workerIndex)) {
+				Execute(job);
+				spins = 0;
+				continue;
+			}
+
+			// Only once its own deque is empty, the jobs on it may be some other thread's children.
+			if (m_Stopping.load(std::memory_order_relaxed))
+				break;
+
+			if (++spins < spinsBeforeSleeping) {
+				std::this_thread::yield();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_Sleeping.fetch_add(1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			// No timeout needed: a job scheduled after the check either sees m_Sleeping, and notifies under the lock, or is seen here.
+			m_WakeUp.wait(lock, [this]() { return HasJobs() || m_Stopping.load(std::memory_order_relaxed); });
+			m_Sleeping.fetch_sub(1, std::memory_order_relaxed);
+			spins = 0;
+		}
+
+		t_WorkerIndex = -1;
+	}
+
+	JobSystemStats JobSystem::GetStats() const {
+
+		JobSystemStats stats;
+		stats.Threads = GetThreadCount();
+		for (const std::unique_ptr<Worker>& worker : m_Workers) {
+			stats.Executed += worker->Executed.load(std::memory_order_relaxed);
+			stats.Stolen += worker->Stolen.load(std::memory_order_relaxed);
+		}
+		return stats;
+	}
+}
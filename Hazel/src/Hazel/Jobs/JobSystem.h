@@ -0,0 +1,237 @@
+#pragma once
+
+#include "Hazel/Core.h"
+#include "Hazel/Memory/AllocationTracker.h"
+#include "Hazel/Memory/PoolAllocator.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+namespace Hazel {
+
+	class JobCounter {
+	// Jobs started with JobSystem::Run() that haven't finished yet, children included. Waited on with JobSystem::Wait(), and has to
+	// outlive its jobs, so it usually lives on the stack of the function that waits on it.
+	public:
+
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		inline bool IsDone() const { return m_Count.load(std::memory_order_acquire) == 0; }
+
+	private:
+
+		std::atomic<int32_t> m_Count{ 0 };
+
+		friend class JobSystem;
+	};
+
+
+	struct Job {
+	// A closure and the bookkeeping to run it. Made by the JobSystem, from the PoolAllocator, and freed by whichever thread finishes it.
+	// A job is only finished once its function has returned and all of its children have finished too, which is when its parent's
+	// Unfinished count, (or its JobCounter) goes down.
+
+		HZ_POOL_ALLOCATED()
+
+		static constexpr uint32_t Size = 128;
+		static constexpr uint32_t ClosureSize = Size - 32;
+
+		using InvokeFn = void(*)(void* closure); // runs the closure and destroys it
+
+		InvokeFn Invoke = nullptr;
+		Job* Parent = nullptr;
+		JobCounter* Counter = nullptr;
+		std::atomic<int32_t> Unfinished{ 1 };	// itself, and its children
+		AllocationTag Tag = AllocationTag::Untagged; // of the thread that made it, the job's allocations are charged to it too
+		alignas(16) uint8_t Closure[ClosureSize];
+	};
+
+	static_assert(sizeof(Job) == Job::Size, "Job isn't the size it says it is");
+
+
+	class JobDeque {
+	// A Chase-Lev work-stealing deque: its worker pushes and pops jobs at the bottom, without a compare-and-swap unless it's popping the
+	// last one, while other threads steal from the top. The ring has a fixed size, Push() fails when it's full and the job has to be
+	// run straight away instead.
+	public:
+
+		static constexpr uint32_t Capacity = 4096;
+
+		bool Push(Job* job);		// owner only
+		Job* Pop();					// owner only, the job pushed last
+		Job* Steal();				// any thread, the job pushed first
+
+		inline bool IsEmpty() const { return m_Bottom.load(std::memory_order_relaxed) <= m_Top.load(std::memory_order_relaxed); }
+
+	private:
+
+		alignas(64) std::atomic<int64_t> m_Top{ 0 };
+		alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+		std::atomic<Job*> m_Jobs[Capacity] = {};
+	};
+
+
+	struct JobSystemStats {
+
+		uint32_t Threads = 0;	// workers, and the thread that called Start()
+		uint64_t Executed = 0;	// jobs, since Start()
+		uint64_t Stolen = 0;	// of those, run by another thread than the one they were pushed on
+	};
+
+
+	class JobSystem {
+	// Worker threads, one per core, (minus the thread that calls Start(), the main thread, which counts as one) each with a JobDeque.
+	// A job that's Run() from a worker, or from the main thread, goes onto that thread's own deque, and threads that run out of jobs
+	// steal from the others'. Any other thread's jobs go into a shared queue, which the workers take from too.
+	// Wait() doesn't block, the waiting thread runs jobs (anyone's) until the counter is done, which is how the main thread takes part.
+	// Jobs can start children with RunChild(), their parent only counts as finished once they have, so whoever waits on the parent's
+	// counter waits for the whole tree: that's how ParallelFor() splits its range without waiting at every level.
+	// When not running, (before Start() or after Stop()) Run() runs the job straight away, so the same code works single-threaded.
+	public:
+
+		JobSystem() = default;
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		// threadCount counts the calling thread, which has to be the one calling Stop() too. 0 is one per hardware thread.
+		void Start(uint32_t threadCount = 0);
+		// Waits for the workers to exit, every job that's been started still runs.
+		void Stop();
+
+		inline bool IsRunning() const { return m_Running; }
+		inline uint32_t GetThreadCount() const { return m_Running ? (uint32_t)m_Workers.size() : 1; }
+
+		// Runs function() on whichever thread gets to it first. counter is done once it, and every job it has started with
+		// RunChild(), have finished.
+		template<typename F>
+		void Run(JobCounter& counter, F&& function) {
+
+			counter.m_Count.fetch_add(1, std::memory_order_relaxed);
+			Job* job = Create(std::forward<F>(function));
+			job->Counter = &counter;
+			Schedule(job);
+		}
+
+		// Only from inside a job: a job that the calling one only finishes after.
+		template<typename F>
+		void RunChild(F&& function) {
+
+			Job* parent = GetCurrentJob();
+			HZ_CORE_ASSERT(parent, "RunChild() outside of a job!");
+
+			parent->Unfinished.fetch_add(1, std::memory_order_relaxed);
+			Job* job = Create(std::forward<F>(function));
+			job->Parent = parent;
+			Schedule(job);
+		}
+
+		// Runs other jobs until counter is done.
+		void Wait(JobCounter& counter);
+
+		// function(begin, end) over [0, count), in ranges of at most grainSize. The range is split in halves, one of which becomes a
+		// child job, until the halves are small enough, so idle threads steal big ranges and split them further themselves.
+		// Returns once all of it has run. A grain should be worth a few microseconds of work, a job costs around a hundred nanoseconds.
+		template<typename F>
+		void ParallelFor(uint32_t count, uint32_t grainSize, F&& function) {
+
+			if (count == 0)
+				return;
+			if (grainSize == 0)
+				grainSize = 1;
+			if (!m_Running || count <= grainSize) {
+				function(0u, count);
+				return;
+			}
+
+			JobCounter counter;
+			Run(counter, [this, &function, count, grainSize]() { ParallelForRange(function, 0, count, grainSize); });
+			Wait(counter);
+		}
+
+		JobSystemStats GetStats() const;
+
+		// The engine's job system, started by the Application.
+		static JobSystem& Get();
+
+	private:
+
+		struct alignas(64) Worker {
+
+			JobDeque Deque;
+			std::thread Thread;
+			std::atomic<uint64_t> Executed{ 0 };
+			std::atomic<uint64_t> Stolen{ 0 };
+		};
+
+		template<typename F>
+		static Job* Create(F&& function) {
+
+			using Closure = std::decay_t<F>;
+			static_assert(sizeof(Closure) <= Job::ClosureSize, "Job closure is too big, capture a pointer to the data instead!");
+			static_assert(alignof(Closure) <= 16, "Job closure is over-aligned!");
+
+			Job* job = new Job();
+			job->Invoke = [](void* closure) {
+				Closure& function = *static_cast<Closure*>(closure);
+				function();
+				function.~Closure();
+			};
+			job->Tag = AllocationTracker::GetThreadTag();
+			new (job->Closure) Closure(std::forward<F>(function));
+			return job;
+		}
+
+		template<typename F>
+		void ParallelForRange(F& function, uint32_t begin, uint32_t end, uint32_t grainSize) {
+
+			while (end - begin > grainSize) {
+
+				uint32_t middle = begin + (end - begin) / 2;
+				RunChild([this, &function, middle, end, grainSize]() { ParallelForRange(function, middle, end, grainSize); });
+				end = middle;
+			}
+			function(begin, end);
+		}
+
+		static Job* GetCurrentJob();
+
+		void Schedule(Job* job);
+		void Execute(Job* job);
+		void Finish(Job* job);
+
+		// A job for the thread with that worker index (-1 when it isn't one): its own first, then the shared queue's, then a stolen one.
+		Job* GetJob(int32_t workerIndex);
+		bool HasJobs() const;
+
+		void WorkerMain(uint32_t workerIndex);
+
+	private:
+
+		bool m_Running = false;
+		std::thread::id m_OwnerID;
+		std::vector<std::unique_ptr<Worker>> m_Workers; // [0] is the thread that called Start(), it has no std::thread of its own
+
+		// Jobs Run() from threads that aren't workers.
+		mutable std::mutex m_SharedMutex;
+		std::deque<Job*> m_SharedJobs;
+		std::atomic<uint32_t> m_SharedCount{ 0 };
+
+		// Workers with nothing to do sleep, rather than spin, after a while.
+		std::mutex m_SleepMutex;
+		std::condition_variable m_WakeUp;
+		std::atomic<uint32_t> m_Sleeping{ 0 };
+		std::atomic<bool> m_Stopping{ false };
+	};
+}
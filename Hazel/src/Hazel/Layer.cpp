@@ -5,7 +5,7 @@
 namespace Hazel {
 
 	Layer::Layer(const std::string& debugName)
-		: m_DebugName(debugName)
+		: m_DebugName(debugName), m_ProfileName(Instrumentor::Get().InternName(debugName))
 	{}
 
 	Layer::~Layer() {}
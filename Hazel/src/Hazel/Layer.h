@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Hazel/Core.h"
+#include "Hazel/Memory/PoolAllocator.h"
 #include "Hazel/Events/Event.h"
+#include "Hazel/Timestep.h"
 
 
 namespace Hazel {
@@ -10,22 +12,72 @@ namespace Hazel {
 	// This is essentially an interface, and most methods will be overrided to tailor to the needs of the specific Layer subclasses. 
 	public:
 
+		HZ_POOL_ALLOCATED()
+
 		Layer(const std::string& name = "Layer");
 		virtual ~Layer();
 
 		virtual void OnAttach() {}
 		virtual void OnDetach() {}
-		virtual void OnUpdate() {}
+		virtual void OnUpdate(Timestep ts) {}		// once per frame, ts is the time since the last frame
+		virtual void OnFixedUpdate(Timestep ts) {}	// 0 to N times per frame when the Application runs a fixed timestep, ts is the fixed step
 		virtual void OnImGuiRender() {}
 		
 		// Each layer subclass' OnEvent function, overriden to tune to subclass' specific needs
 		virtual void OnEvent(Event& event) {} 
 
 		inline const std::string& GetName() const { return m_DebugName; }
+		// The name, interned once by the constructor, (Instrumentor::InternName()) so that profiling the layer's scopes every frame
+		// doesn't hash it and take a lock each time.
+		inline const char* GetProfileName() const { return m_ProfileName; }
+
+		// Whether OnEvent should be called for this event. The LayerStack only routes an event to the layers subscribed to it.
+		inline bool IsSubscribedTo(const Event& event) const {
+			return (m_EventTypes & EventTypeBit(event.GetEventType())) || (m_EventCategories & event.GetCategoryFlags());
+		}
+
+		// Whether OnUpdate() may run on a worker thread, at the same time as other layers' that opted in. (see SetParallelUpdate)
+		inline bool IsParallelUpdate() const { return m_ParallelUpdate; }
+		// Whether the two layers' OnUpdate() must not run at the same time: one of them writes something the other reads or writes.
+		inline bool ConflictsWith(const Layer& other) const {
+			return (m_UpdateWrites & (other.m_UpdateReads | other.m_UpdateWrites)) || (other.m_UpdateWrites & m_UpdateReads);
+		}
+
+	protected:
+
+		// Subscribes the layer to the given EventTypes (see EventTypeMask<>()) and/or EventCategory flags, replacing the default of every 
+		// event. Call this in the layer's constructor, the LayerStack builds its routing tables when the layer is pushed.
+		// eg. SetEventSubscription(EventTypeMask<WindowResizeEvent>(), EventCategoryKeyboard);
+		inline void SetEventSubscription(uint32_t eventTypes, int eventCategories = 0) {
+			m_EventTypes = eventTypes;
+			m_EventCategories = eventCategories;
+		}
+
+		// Opts the layer into the parallel update group: its OnUpdate() runs on the JobSystem, alongside the other opted-in layers next
+		// to it in the stack, except for those it conflicts with, which still run in stack order. reads and writes are masks of the
+		// application's own BIT()s, one per piece of data that layers share, (eg. BIT(0) the audio mixer, BIT(1) the AI world state) and
+		// the layer must not touch anything shared that it hasn't declared, the Renderer, ImGui and Input included, which are main thread
+		// only. Call this in the layer's constructor, like SetEventSubscription().
+		inline void SetParallelUpdate(uint32_t reads, uint32_t writes) {
+			m_ParallelUpdate = true;
+			m_UpdateReads = reads;
+			m_UpdateWrites = writes;
+		}
 
 	protected:
 
 		std::string m_DebugName;
+
+	private:
+
+		const char* m_ProfileName;
+
+		uint32_t m_EventTypes = AllEventTypes;
+		int m_EventCategories = 0;
+
+		bool m_ParallelUpdate = false;
+		uint32_t m_UpdateReads = 0;
+		uint32_t m_UpdateWrites = 0;
 	};
 }
 
@@ -35,6 +87,12 @@ namespace Hazel {
 -- Beyond Graphics: Layers are not just for graphics. They are crucial for handling events and update logic. Each layer in the layer stack 
    can be updated in each iteration of the game loop.
 
+-- Event Subscriptions: A layer only receives the events it's subscribed to (every event by default). This keeps the cost of dispatching 
+   an event proportional to the number of layers interested in it, rather than the total amount of layers in the stack.
+
+-- Parallel Updates: A layer that only touches its own data (or declares what it shares, see SetParallelUpdate) can have its OnUpdate run
+   on a worker thread, at the same time as other such layers. Layers that don't opt in are still updated one at a time, in stack order.
+
 -- Layer Class: This class represents a single layer. It includes methods for lifecycle events (attach, detach), updating, and event handling. 
    Developers can subclass this to create specific layers like a game layer or UI layer.
 */
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "hzpch.h"
 #include "LayerStack.h"
 
+#include "Hazel/Timer.h"
+#include "Hazel/Jobs/JobSystem.h"
+
 
 namespace Hazel {
 
@@ -17,6 +20,8 @@ namespace Hazel {
 
 		m_Layers.emplace(m_Layers.begin() + m_LayerInsertIndex, layer);
 		m_LayerInsertIndex++;
+		InvalidateEventRoutes();
+		InvalidateUpdateSchedule();
 	}
 
 	void LayerStack::PushOverlay(Layer* overlay) {
@@ -24,6 +29,8 @@ namespace Hazel {
 		// Adds a new element to the end of the vector.
 		// CONSTRUCTS an element in-place at the back of the vector, eliminating the need for a copy or move of the element.
 		m_Layers.emplace_back(overlay); 
+		InvalidateEventRoutes();
+		InvalidateUpdateSchedule();
 	}
 
 	void LayerStack::PopLayer(Layer* layer) {
@@ -32,6 +39,8 @@ namespace Hazel {
 		if (it != m_Layers.end()) {
 			m_Layers.erase(it);
 			m_LayerInsertIndex--;
+			InvalidateEventRoutes();
+			InvalidateUpdateSchedule();
 		}
 	}
 
@@ -57,6 +66,101 @@ namespace Hazel {
 		auto it = std::find(m_Layers.begin(), m_Layers.end(), overlay);
 		if (it != m_Layers.end()) {
 			m_Layers.erase(it);
+			InvalidateEventRoutes();
+			InvalidateUpdateSchedule();
+		}
+	}
+
+	const std::vector<Layer*>& LayerStack::GetEventSubscribers(const Event& event) {
+
+		size_t type = (size_t)event.GetEventType();
+		std::vector<Layer*>& route = m_EventRoutes[type];
+
+		if (!m_EventRouteBuilt[type]) {
+
+			route.clear();
+			for (Layer* layer : m_Layers) {
+				if (layer->IsSubscribedTo(event))
+					route.push_back(layer);
+			}
+			m_EventRouteBuilt[type] = true;
+		}
+
+		return route;
+	}
+
+	void LayerStack::InvalidateEventRoutes() {
+		std::fill(std::begin(m_EventRouteBuilt), std::end(m_EventRouteBuilt), false);
+	}
+
+	const std::vector<LayerUpdateStage>& LayerStack::GetUpdateSchedule() {
+
+		if (m_UpdateScheduleBuilt)
+			return m_UpdateSchedule;
+
+		m_UpdateSchedule.clear();
+
+		// The run of parallel layers since the last layer that isn't, split into stages.
+		std::vector<LayerUpdateStage> group;
+		auto endGroup = [this, &group]() {
+			for (LayerUpdateStage& stage : group)
+				m_UpdateSchedule.push_back(std::move(stage));
+			group.clear();
+		};
+
+		for (Layer* layer : m_Layers) {
+
+			if (!layer->IsParallelUpdate()) {
+				endGroup();
+				m_UpdateSchedule.push_back({ { layer } });
+				continue;
+			}
+
+			size_t stage = 0;
+			for (size_t i = 0; i < group.size(); i++) {
+				for (Layer* other : group[i].Layers) {
+					if (layer->ConflictsWith(*other))
+						stage = i + 1;
+				}
+			}
+
+			if (stage == group.size())
+				group.emplace_back();
+			group[stage].Layers.push_back(layer);
+		}
+		endGroup();
+
+		m_UpdateScheduleBuilt = true;
+		return m_UpdateSchedule;
+	}
+
+	void LayerStack::OnUpdate(Timestep ts, FrameStats& frameStats) {
+
+		for (const LayerUpdateStage& stage : GetUpdateSchedule()) {
+
+			if (stage.Layers.size() == 1) {
+
+				Layer* layer = stage.Layers[0];
+				HZ_PROFILE_SCOPE(layer->GetProfileName());
+				Timer layerTimer;
+				layer->OnUpdate(ts);
+				frameStats.RecordLayerUpdate(layer->GetName(), (float)layerTimer.ElapsedMillis());
+				continue;
+			}
+
+			m_StageMilliseconds.resize(stage.Layers.size());
+			JobSystem::Get().ParallelFor((uint32_t)stage.Layers.size(), 1, [this, &stage, ts](uint32_t begin, uint32_t end) {
+				for (uint32_t i = begin; i < end; i++) {
+					Layer* layer = stage.Layers[i];
+					HZ_PROFILE_SCOPE(layer->GetProfileName());
+					Timer layerTimer;
+					layer->OnUpdate(ts);
+					m_StageMilliseconds[i] = (float)layerTimer.ElapsedMillis();
+				}
+			});
+
+			for (size_t i = 0; i < stage.Layers.size(); i++)
+				frameStats.RecordLayerUpdate(stage.Layers[i]->GetName(), m_StageMilliseconds[i]);
 		}
 	}
 }
\ No newline at end of file
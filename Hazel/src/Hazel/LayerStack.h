@@ -2,12 +2,20 @@
 
 #include "Hazel/Core.h"
 #include "Layer.h"
+#include "Hazel/Debug/FrameStats.h"
 
 #include <vector>
 
 
 namespace Hazel {
 
+	// Layers whose OnUpdate() runs at the same time, or a single layer.
+	struct LayerUpdateStage {
+
+		std::vector<Layer*> Layers;
+	};
+
+
 	class HAZEL_API LayerStack {
 
 	public:
@@ -22,11 +30,39 @@ namespace Hazel {
 
 		std::vector<Layer*>::iterator begin() { return m_Layers.begin(); }
 		std::vector<Layer*>::iterator end() { return m_Layers.end(); }
+		std::vector<Layer*>::reverse_iterator rbegin() { return m_Layers.rbegin(); }
+		std::vector<Layer*>::reverse_iterator rend() { return m_Layers.rend(); }
+
+		// The layers subscribed to this event's type, in the same bottom to top order as the stack itself.
+		const std::vector<Layer*>& GetEventSubscribers(const Event& event);
+
+		// Only needed if a layer changes its event subscription after it was pushed.
+		void InvalidateEventRoutes();
+
+		// The order OnUpdate() runs in, bottom to top. A layer that isn't parallel (see Layer::SetParallelUpdate) is a stage of its own,
+		// so it runs after everything below it and before everything above it, as always. Runs of parallel layers in between are split
+		// into as few stages as their conflicts allow: a layer goes one stage after the last one it conflicts with.
+		const std::vector<LayerUpdateStage>& GetUpdateSchedule();
+		// Only needed if a layer changes its parallel update after it was pushed.
+		inline void InvalidateUpdateSchedule() { m_UpdateScheduleBuilt = false; }
+
+		// Every layer's OnUpdate(), following the schedule, a stage of several layers through the JobSystem. Each stage is joined before
+		// the next one starts, and the last one before this returns. Per layer timings go into frameStats.
+		void OnUpdate(Timestep ts, FrameStats& frameStats);
 
 	private:
 
 		std::vector<Layer*> m_Layers;
 		unsigned int m_LayerInsertIndex = 0;
+
+		// Per-EventType subscriber lists. Built lazily from the first event of each type, since an event's category flags are only known
+		// from an instance of it. (they never change for a given type though)
+		std::vector<Layer*> m_EventRoutes[EventTypeCount];
+		bool m_EventRouteBuilt[EventTypeCount] = {};
+
+		std::vector<LayerUpdateStage> m_UpdateSchedule;
+		bool m_UpdateScheduleBuilt = false;
+		std::vector<float> m_StageMilliseconds; // a parallel stage's timings, FrameStats is main thread only
 	};
 }
 
@@ -54,6 +90,9 @@ namespace Hazel {
 -- Overlays: Overlays are a special type of layer that always render last. This is crucial for UI elements that need to be on top of other 
    content, like menus or HUDs.
 
+-- Parallel Updates: Layers that opt in (see Layer::SetParallelUpdate) and sit next to each other in the stack are updated at the same time, 
+   on the JobSystem, unless they declared conflicting reads/writes. Every other layer is still a strict barrier in the update order.
+
 -- Updating Layers: During each iteration of the game loop, each layer in the stack is updated in order. This means that layers added earlier 
    to the stack are updated before the layers added later. Update Order && Render Order:
 
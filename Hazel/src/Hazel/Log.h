@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core.h"
+#include "Hazel/Memory/AllocationTracker.h"
 
 #include "spdlog/spdlog.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
@@ -29,21 +30,21 @@ namespace Hazel {
 }
 
 
-//Defining Core Log Macros
-#define HZ_CORE_TRACE(...)      ::Hazel::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define HZ_CORE_DEBUGS(...)     ::Hazel::Log::GetCoreLogger()->debug(__VA_ARGS__)
-#define HZ_CORE_INFO(...)       ::Hazel::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define HZ_CORE_WARN(...)       ::Hazel::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define HZ_CORE_ERROR(...)      ::Hazel::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define HZ_CORE_CRITICAL(...)   ::Hazel::Log::GetCoreLogger()->critical(__VA_ARGS__)
+// Defining Core Log Macros. Whatever spdlog allocates to format and write the message is charged to AllocationTag::Log.
+#define HZ_CORE_TRACE(...)      HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetCoreLogger()->trace(__VA_ARGS__))
+#define HZ_CORE_DEBUGS(...)     HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetCoreLogger()->debug(__VA_ARGS__))
+#define HZ_CORE_INFO(...)       HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetCoreLogger()->info(__VA_ARGS__))
+#define HZ_CORE_WARN(...)       HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetCoreLogger()->warn(__VA_ARGS__))
+#define HZ_CORE_ERROR(...)      HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetCoreLogger()->error(__VA_ARGS__))
+#define HZ_CORE_CRITICAL(...)   HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetCoreLogger()->critical(__VA_ARGS__))
 
 //Defining Client Log Macros
-#define HZ_TRACE(...)     ::Hazel::Log::GetClientLogger()->trace(__VA_ARGS__)
-#define HZ_DEBUGS(...)    ::Hazel::Log::GetClientLogger()->debug(__VA_ARGS__) // need to change name from HZ_DEBUG because of naming collision with premake5.lua
-#define HZ_INFO(...)      ::Hazel::Log::GetClientLogger()->info(__VA_ARGS__)
-#define HZ_WARN(...)      ::Hazel::Log::GetClientLogger()->warn(__VA_ARGS__)
-#define HZ_ERROR(...)     ::Hazel::Log::GetClientLogger()->error(__VA_ARGS__)
-#define HZ_CRITICAL(...)  ::Hazel::Log::GetClientLogger()->critical(__VA_ARGS__)
+#define HZ_TRACE(...)     HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetClientLogger()->trace(__VA_ARGS__))
+#define HZ_DEBUGS(...)    HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetClientLogger()->debug(__VA_ARGS__)) // need to change name from HZ_DEBUG because of naming collision with premake5.lua
+#define HZ_INFO(...)      HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetClientLogger()->info(__VA_ARGS__))
+#define HZ_WARN(...)      HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetClientLogger()->warn(__VA_ARGS__))
+#define HZ_ERROR(...)     HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetClientLogger()->error(__VA_ARGS__))
+#define HZ_CRITICAL(...)  HZ_ALLOCATION_TAGGED(Log, ::Hazel::Log::GetClientLogger()->critical(__VA_ARGS__))
 
 
 
@@ -0,0 +1,311 @@
+#include "hzpch.h"
+#include "AllocationTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+
+
+namespace Hazel {
+
+	int64_t AllocationTracker::s_FrameBudget = -1;
+
+	const char* AllocationTagToString(AllocationTag tag) {
+
+		switch (tag) {
+
+			case AllocationTag::Untagged:	return "Untagged";
+			case AllocationTag::Renderer:	return "Renderer";
+			case AllocationTag::Events:		return "Events";
+			case AllocationTag::ImGui:		return "ImGui";
+			case AllocationTag::Layers:		return "Layers";
+			case AllocationTag::Log:		return "Log";
+		}
+		return "Unknown";
+	}
+
+#ifdef HZ_ENABLE_ALLOCATION_TRACKING
+
+	// Everything here is used by operator new, which runs before (and after) any other static initialisation: only constant
+	// initialised globals, no constructors.
+	struct TagCounters {
+
+		std::atomic<uint64_t> FrameAllocations{ 0 };
+		std::atomic<uint64_t> FrameBytes{ 0 };
+		std::atomic<uint64_t> FrameFrees{ 0 };
+		std::atomic<int64_t> LiveAllocations{ 0 };
+		std::atomic<int64_t> LiveBytes{ 0 };
+	};
+
+	static TagCounters s_Counters[AllocationTagCount];
+	static std::atomic<int64_t> s_LiveBytes{ 0 };
+	static std::atomic<int64_t> s_PeakLiveBytes{ 0 };
+	static thread_local AllocationTag t_Tag = AllocationTag::Untagged;
+
+	// Main thread only, written by NextFrame().
+	static AllocationStats s_LastFrame;
+
+	static bool GetDefaultEnabled() {
+
+		const char* value = std::getenv("HZ_TRACK_ALLOCATIONS");
+		return value && std::strcmp(value, "1") == 0;
+	}
+
+	// Zero, (false) as for every static, until static initialisation gets here. Whatever was allocated before isn't counted.
+	static std::atomic<bool> s_Enabled = GetDefaultEnabled();
+
+	// In front of every allocation. Alignment is how far in front of the allocation the block malloc returned starts.
+	struct alignas(16) AllocationHeader {
+
+		size_t Size;
+		uint32_t Alignment;
+		AllocationTag Tag;
+		bool Tracked;
+	};
+
+	static_assert(sizeof(AllocationHeader) == 16, "The header has to keep malloc's 16 byte alignment");
+
+	static void CountAllocation(size_t size, AllocationTag tag) {
+
+		TagCounters& counters = s_Counters[(size_t)tag];
+		counters.FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+		counters.FrameBytes.fetch_add(size, std::memory_order_relaxed);
+		counters.LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+		counters.LiveBytes.fetch_add((int64_t)size, std::memory_order_relaxed);
+
+		int64_t live = s_LiveBytes.fetch_add((int64_t)size, std::memory_order_relaxed) + (int64_t)size;
+		int64_t peak = s_PeakLiveBytes.load(std::memory_order_relaxed);
+		while (live > peak && !s_PeakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+	}
+
+	static void CountFree(size_t size, AllocationTag tag) {
+
+		TagCounters& counters = s_Counters[(size_t)tag];
+		counters.FrameFrees.fetch_add(1, std::memory_order_relaxed);
+		counters.LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+		counters.LiveBytes.fetch_sub((int64_t)size, std::memory_order_relaxed);
+		s_LiveBytes.fetch_sub((int64_t)size, std::memory_order_relaxed);
+	}
+
+	static void* TrackedAllocate(size_t size, size_t alignment) {
+
+		if (alignment < sizeof(AllocationHeader))
+			alignment = sizeof(AllocationHeader);
+
+		// The header goes in the alignment bytes right in front of what's returned. That's all padding above 16 bytes, fine for the odd
+		// cache line aligned object, not for big alignments: (the PoolAllocator's chunks) those skip operator new, see RecordAllocation().
+		void* block;
+		if (alignment == sizeof(AllocationHeader)) {
+			block = std::malloc(alignment + size);
+		}
+		else {
+#ifdef HZ_PLATFORM_WINDOWS
+			block = _aligned_malloc(alignment + size, alignment);
+#else
+			size_t blockSize = (alignment + size + alignment - 1) & ~(alignment - 1); // aligned_alloc() wants a multiple of alignment
+			block = std::aligned_alloc(alignment, blockSize);
+#endif
+		}
+
+		if (!block)
+			return nullptr;
+
+		uint8_t* memory = static_cast<uint8_t*>(block) + alignment;
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(memory) - 1;
+		header->Size = size;
+		header->Alignment = (uint32_t)alignment;
+		header->Tag = t_Tag;
+		header->Tracked = s_Enabled.load(std::memory_order_relaxed);
+
+		if (header->Tracked)
+			CountAllocation(size, header->Tag);
+
+		return memory;
+	}
+
+	static void TrackedFree(void* memory) {
+
+		if (!memory)
+			return;
+
+		AllocationHeader* header = static_cast<AllocationHeader*>(memory) - 1;
+		if (header->Tracked)
+			CountFree(header->Size, header->Tag);
+
+		uint32_t alignment = header->Alignment;
+		void* block = static_cast<uint8_t*>(memory) - alignment;
+		if (alignment == sizeof(AllocationHeader)) {
+			std::free(block);
+		}
+		else {
+#ifdef HZ_PLATFORM_WINDOWS
+			_aligned_free(block);
+#else
+			std::free(block);
+#endif
+		}
+	}
+
+	static void* TrackedAllocateOrThrow(size_t size, size_t alignment) {
+
+		void* memory = TrackedAllocate(size ? size : 1, alignment);
+		if (!memory)
+			throw std::bad_alloc();
+		return memory;
+	}
+
+	void AllocationTracker::SetEnabled(bool enabled) {
+		s_Enabled = enabled;
+	}
+
+	bool AllocationTracker::IsEnabled() {
+		return s_Enabled;
+	}
+
+	void AllocationTracker::SetThreadTag(AllocationTag tag) {
+		t_Tag = tag;
+	}
+
+	AllocationTag AllocationTracker::GetThreadTag() {
+		return t_Tag;
+	}
+
+	bool AllocationTracker::RecordAllocation(size_t size, AllocationTag tag) {
+
+		if (!s_Enabled.load(std::memory_order_relaxed))
+			return false;
+
+		CountAllocation(size, tag);
+		return true;
+	}
+
+	void AllocationTracker::RecordFree(size_t size, AllocationTag tag) {
+		CountFree(size, tag);
+	}
+
+	void AllocationTracker::NextFrame() {
+
+		AllocationStats stats;
+		for (size_t i = 0; i < AllocationTagCount; i++) {
+
+			TagCounters& counters = s_Counters[i];
+			AllocationTagStats& tag = stats.Tags[i];
+			tag.FrameAllocations = counters.FrameAllocations.exchange(0, std::memory_order_relaxed);
+			tag.FrameBytes = counters.FrameBytes.exchange(0, std::memory_order_relaxed);
+			tag.FrameFrees = counters.FrameFrees.exchange(0, std::memory_order_relaxed);
+			tag.LiveAllocations = counters.LiveAllocations.load(std::memory_order_relaxed);
+			tag.LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed);
+
+			stats.Total.FrameAllocations += tag.FrameAllocations;
+			stats.Total.FrameBytes += tag.FrameBytes;
+			stats.Total.FrameFrees += tag.FrameFrees;
+			stats.Total.LiveAllocations += tag.LiveAllocations;
+			stats.Total.LiveBytes += tag.LiveBytes;
+		}
+
+		stats.PeakLiveBytes = s_PeakLiveBytes.load(std::memory_order_relaxed);
+		stats.Frames = s_LastFrame.Frames + (s_Enabled ? 1 : 0);
+		stats.FramesOverBudget = s_LastFrame.FramesOverBudget;
+
+		// Only warns when a frame goes over after one that didn't, a frame that always allocates would flood the log otherwise.
+		bool overBudget = s_Enabled && s_FrameBudget >= 0 && (int64_t)stats.Total.FrameAllocations > s_FrameBudget;
+		bool wasOverBudget = s_FrameBudget >= 0 && (int64_t)s_LastFrame.Total.FrameAllocations > s_FrameBudget;
+		if (overBudget) {
+			stats.FramesOverBudget++;
+			if (!wasOverBudget) {
+				HZ_CORE_WARN("Frame {0}: {1} allocations, over the budget of {2} (Renderer {3}, Events {4}, ImGui {5}, Layers {6}, Log {7})",
+					stats.Frames, stats.Total.FrameAllocations, s_FrameBudget,
+					stats.Tags[(size_t)AllocationTag::Renderer].FrameAllocations, stats.Tags[(size_t)AllocationTag::Events].FrameAllocations,
+					stats.Tags[(size_t)AllocationTag::ImGui].FrameAllocations, stats.Tags[(size_t)AllocationTag::Layers].FrameAllocations,
+					stats.Tags[(size_t)AllocationTag::Log].FrameAllocations);
+			}
+		}
+
+		s_LastFrame = stats;
+	}
+
+	AllocationStats AllocationTracker::GetStats() {
+		return s_LastFrame;
+	}
+
+#else
+
+	void AllocationTracker::SetEnabled(bool enabled) {}
+	bool AllocationTracker::IsEnabled() { return false; }
+	void AllocationTracker::SetThreadTag(AllocationTag tag) {}
+	AllocationTag AllocationTracker::GetThreadTag() { return AllocationTag::Untagged; }
+	bool AllocationTracker::RecordAllocation(size_t size, AllocationTag tag) { return false; }
+	void AllocationTracker::RecordFree(size_t size, AllocationTag tag) {}
+	void AllocationTracker::NextFrame() {}
+	AllocationStats AllocationTracker::GetStats() { return AllocationStats(); }
+
+#endif
+
+	void AllocationTracker::SetFrameBudget(int64_t allocations) {
+		s_FrameBudget = allocations;
+	}
+
+	bool AllocationTracker::Dump(const std::string& filepath) {
+
+		std::ofstream out(filepath);
+		if (!out) {
+			HZ_CORE_ERROR("Could not open file '{0}'", filepath);
+			return false;
+		}
+
+		AllocationStats stats = GetStats();
+		char line[256];
+		auto row = [&](const char* name, const AllocationTagStats& tag) {
+			snprintf(line, sizeof(line), "%-10s %12llu %14llu %10llu %12lld %14lld\n", name, (unsigned long long)tag.FrameAllocations,
+				(unsigned long long)tag.FrameBytes, (unsigned long long)tag.FrameFrees, (long long)tag.LiveAllocations, (long long)tag.LiveBytes);
+			out << line;
+		};
+
+		out << "Hazel allocations, " << (IsEnabled() ? "tracking enabled" : "tracking disabled") << ", after " << stats.Frames << " frames\n";
+		out << "Peak live bytes: " << stats.PeakLiveBytes << "\n";
+		out << "Frames over the budget of " << s_FrameBudget << ": " << stats.FramesOverBudget << "\n\n";
+
+		snprintf(line, sizeof(line), "%-10s %12s %14s %10s %12s %14s\n", "tag", "allocs/frame", "bytes/frame", "frees/frame", "live allocs",
+			"live bytes");
+		out << line;
+		for (size_t i = 0; i < AllocationTagCount; i++)
+			row(AllocationTagToString((AllocationTag)i), stats.Tags[i]);
+		row("Total", stats.Total);
+
+		HZ_CORE_INFO("Allocation stats written to '{0}'", filepath);
+		return true;
+	}
+}
+
+#ifdef HZ_ENABLE_ALLOCATION_TRACKING
+
+// The replaceable global allocation functions, all of them, so that nothing reaches the default ones with a header in front of it.
+void* operator new(size_t size) { return Hazel::TrackedAllocateOrThrow(size, 0); }
+void* operator new[](size_t size) { return Hazel::TrackedAllocateOrThrow(size, 0); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return Hazel::TrackedAllocate(size ? size : 1, 0); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return Hazel::TrackedAllocate(size ? size : 1, 0); }
+void* operator new(size_t size, std::align_val_t alignment) { return Hazel::TrackedAllocateOrThrow(size, (size_t)alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return Hazel::TrackedAllocateOrThrow(size, (size_t)alignment); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+	return Hazel::TrackedAllocate(size ? size : 1, (size_t)alignment);
+}
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+	return Hazel::TrackedAllocate(size ? size : 1, (size_t)alignment);
+}
+
+void operator delete(void* memory) noexcept { Hazel::TrackedFree(memory); }
+void operator delete[](void* memory) noexcept { Hazel::TrackedFree(memory); }
+void operator delete(void* memory, size_t) noexcept { Hazel::TrackedFree(memory); }
+void operator delete[](void* memory, size_t) noexcept { Hazel::TrackedFree(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { Hazel::TrackedFree(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { Hazel::TrackedFree(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { Hazel::TrackedFree(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { Hazel::TrackedFree(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { Hazel::TrackedFree(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { Hazel::TrackedFree(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { Hazel::TrackedFree(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { Hazel::TrackedFree(memory); }
+
+#endif
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Hazel/Core.h"
+
+#include <cstdint>
+#include <string>
+
+// Global operator new/delete are replaced (in AllocationTracker.cpp) in every build but Dist, or when HZ_DISABLE_ALLOCATION_TRACKING
+// is defined. Counting is off until AllocationTracker::SetEnabled(true), or HZ_TRACK_ALLOCATIONS=1 in the environment.
+#if !defined(HZ_DIST) && !defined(HZ_DISABLE_ALLOCATION_TRACKING)
+	#define HZ_ENABLE_ALLOCATION_TRACKING
+#endif
+
+
+namespace Hazel {
+
+	// Who an allocation is charged to: the tag of the thread that made it, at the time. (see ScopedAllocationTag)
+	enum class AllocationTag : uint8_t {
+		Untagged = 0,
+		Renderer, Events, ImGui, Layers, Log
+	};
+
+	constexpr size_t AllocationTagCount = (size_t)AllocationTag::Log + 1;
+
+	const char* AllocationTagToString(AllocationTag tag);
+
+	struct AllocationTagStats {
+
+		uint64_t FrameAllocations = 0;	// during the last frame
+		uint64_t FrameBytes = 0;
+		uint64_t FrameFrees = 0;
+		int64_t LiveAllocations = 0;	// right now, of what was allocated while tracking was enabled
+		int64_t LiveBytes = 0;
+	};
+
+	struct AllocationStats {
+
+		AllocationTagStats Tags[AllocationTagCount];
+		AllocationTagStats Total;
+		int64_t PeakLiveBytes = 0;			// since tracking was enabled
+		uint64_t Frames = 0;				// counted so far
+		uint64_t FramesOverBudget = 0;		// with more allocations than SetFrameBudget() allows
+	};
+
+
+	class AllocationTracker {
+	// Counts every heap allocation made through operator new, (and ImGui's, which the ImGuiLayer routes through it) per AllocationTag:
+	// how many and how many bytes each frame, and how much is live. Each allocation carries a small header with its size and tag, so
+	// a free is charged to the tag that allocated it, whichever thread frees it.
+	// Meant for setting budgets, "no allocations in a steady-state frame" in particular: SetFrameBudget() warns whenever a frame goes
+	// over. Numbers are per frame of the Application, which calls NextFrame() at the start of each one.
+	public:
+
+		static constexpr bool IsCompiledIn() {
+#ifdef HZ_ENABLE_ALLOCATION_TRACKING
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		// Allocations made while disabled are never counted, not even when they're freed later.
+		static void SetEnabled(bool enabled);
+		static bool IsEnabled();
+
+		// Tag for the calling thread's allocations from now on. The render thread's are Renderer, everything else starts Untagged.
+		static void SetThreadTag(AllocationTag tag);
+		static AllocationTag GetThreadTag();
+
+		// For memory that doesn't come from operator new, (the PoolAllocator's chunks, which are aligned to their size, so a header in
+		// front would cost a whole chunk) counted by hand as one allocation of size bytes. Returns whether it was counted, only then does
+		// it get a RecordFree(), with the same size and tag.
+		static bool RecordAllocation(size_t size, AllocationTag tag);
+		static void RecordFree(size_t size, AllocationTag tag);
+
+		// Frames with more than allocations heap allocations are logged, and counted in AllocationStats::FramesOverBudget. -1 is no budget.
+		static void SetFrameBudget(int64_t allocations);
+		inline static int64_t GetFrameBudget() { return s_FrameBudget; }
+
+		// Ends the frame's counts. Main thread.
+		static void NextFrame();
+		// The last frame's counts, and what's live right now.
+		static AllocationStats GetStats();
+
+		// The current stats as a text table, false if the file couldn't be written.
+		static bool Dump(const std::string& filepath);
+
+	private:
+
+		static int64_t s_FrameBudget;
+	};
+
+
+	class ScopedAllocationTag {
+	// Charges the calling thread's allocations to tag until the end of the scope, then goes back to what it was before.
+	public:
+
+		ScopedAllocationTag(AllocationTag tag)
+			: m_Previous(AllocationTracker::GetThreadTag()) {
+
+			AllocationTracker::SetThreadTag(tag);
+		}
+
+		~ScopedAllocationTag() {
+			AllocationTracker::SetThreadTag(m_Previous);
+		}
+
+	private:
+
+		AllocationTag m_Previous;
+	};
+}
+
+// HZ_ALLOCATION_TAG(Renderer) tags the rest of the scope, HZ_ALLOCATION_TAGGED(Log, expression) only that expression. (its temporaries
+// live to the end of the full expression) Both compile to nothing, or just the expression, without tracking.
+#ifdef HZ_ENABLE_ALLOCATION_TRACKING
+	#define HZ_ALLOCATION_TAG_CONCAT_(a, b) a##b
+	#define HZ_ALLOCATION_TAG_CONCAT(a, b) HZ_ALLOCATION_TAG_CONCAT_(a, b)
+	#define HZ_ALLOCATION_TAG(tag) ::Hazel::ScopedAllocationTag HZ_ALLOCATION_TAG_CONCAT(allocationTag, __LINE__)(::Hazel::AllocationTag::tag)
+	#define HZ_ALLOCATION_TAGGED(tag, expression) (::Hazel::ScopedAllocationTag(::Hazel::AllocationTag::tag), (expression))
+#else
+	#define HZ_ALLOCATION_TAG(tag)
+	#define HZ_ALLOCATION_TAGGED(tag, expression) (expression)
+#endif
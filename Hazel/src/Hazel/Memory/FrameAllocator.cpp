@@ -0,0 +1,129 @@
+#include "hzpch.h"
+#include "FrameAllocator.h"
+
+#include <cstring>
+
+
+namespace Hazel {
+
+	FrameAllocator::FrameAllocator(size_t blockSize)
+		: m_BlockSize(blockSize) {
+
+		// A block for each frame up front, so that the first frames don't start with an overflow.
+		for (Buffer& buffer : m_Buffers) {
+			buffer.Blocks.push_back(std::make_unique<Block>());
+			buffer.Blocks.back()->Memory = std::make_unique<uint8_t[]>(m_BlockSize);
+			buffer.Blocks.back()->Capacity = m_BlockSize;
+		}
+		m_Block = m_Buffers[0].Blocks[0].get();
+	}
+
+	FrameAllocator& FrameAllocator::Get() {
+
+		static FrameAllocator instance;
+		return instance;
+	}
+
+	void* FrameAllocator::Allocate(size_t size, size_t alignment) {
+
+		HZ_CORE_ASSERT(alignment && (alignment & (alignment - 1)) == 0, "Alignment has to be a power of 2!");
+
+		for (;;) {
+
+			// Threads only ever race for the same block's Used, whoever loses tries again further along.
+			Block* block = m_Block.load(std::memory_order_acquire);
+			uintptr_t base = (uintptr_t)block->Memory.get();
+			size_t used = block->Used.load(std::memory_order_relaxed);
+
+			for (;;) {
+
+				size_t offset = ((base + used + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base;
+				if (offset + size > block->Capacity)
+					break;
+
+				if (block->Used.compare_exchange_weak(used, offset + size, std::memory_order_relaxed)) {
+					m_Allocations.fetch_add(1, std::memory_order_relaxed);
+					return (void*)(base + offset);
+				}
+			}
+
+			Grow(block, size + alignment);
+		}
+	}
+
+	const char* FrameAllocator::Copy(std::string_view string) {
+
+		char* copy = static_cast<char*>(Allocate(string.size() + 1, 1));
+		std::memcpy(copy, string.data(), string.size());
+		copy[string.size()] = '\0';
+		return copy;
+	}
+
+	void FrameAllocator::Grow(Block* block, size_t size) {
+
+		std::lock_guard<std::mutex> lock(m_GrowMutex);
+
+		// Another thread ran out at the same time, and has moved on to the next block already.
+		if (m_Block.load(std::memory_order_relaxed) != block)
+			return;
+
+		// The next block, if the frame has used this many before. Else a new one, big enough for this allocation at least.
+		Buffer& buffer = m_Buffers[m_CurrentBuffer];
+		buffer.CurrentBlock++;
+		if (buffer.CurrentBlock == buffer.Blocks.size() || buffer.Blocks[buffer.CurrentBlock]->Capacity < size) {
+
+			auto newBlock = std::make_unique<Block>();
+			newBlock->Capacity = size > m_BlockSize ? size : m_BlockSize;
+			newBlock->Memory = std::make_unique<uint8_t[]>(newBlock->Capacity);
+			buffer.Blocks.insert(buffer.Blocks.begin() + buffer.CurrentBlock, std::move(newBlock));
+
+			m_Overflows++;
+			HZ_CORE_WARN("FrameAllocator: frame {0} needed another block ({1} KB, {2} blocks now)", m_FrameIndex,
+				buffer.Blocks[buffer.CurrentBlock]->Capacity / 1024, buffer.Blocks.size());
+		}
+
+		m_Block.store(buffer.Blocks[buffer.CurrentBlock].get(), std::memory_order_release);
+	}
+
+	size_t FrameAllocator::GetUsed(const Buffer& buffer) const {
+
+		// Allocations that don't fit never move Used, (see Allocate()) so it's at most the Capacity.
+		size_t used = 0;
+		for (const auto& block : buffer.Blocks)
+			used += block->Used.load(std::memory_order_relaxed);
+		return used;
+	}
+
+	void FrameAllocator::NextFrame() {
+
+		HZ_PROFILE_FUNCTION();
+
+		size_t used = GetUsed(m_Buffers[m_CurrentBuffer]);
+		m_LastFrameStats.Allocations = m_Allocations.exchange(0, std::memory_order_relaxed);
+		m_LastFrameStats.Used = used;
+		m_LastFrameStats.HighWater = std::max(m_LastFrameStats.HighWater, used);
+		m_LastFrameStats.Overflows = m_Overflows;
+		m_LastFrameStats.Capacity = 0;
+		for (const Buffer& buffer : m_Buffers)
+			for (const auto& block : buffer.Blocks)
+				m_LastFrameStats.Capacity += block->Capacity;
+
+		m_CurrentBuffer ^= 1;
+		m_FrameIndex++;
+
+		// What was allocated two frames ago goes.
+		Buffer& buffer = m_Buffers[m_CurrentBuffer];
+		for (auto& block : buffer.Blocks) {
+#if HZ_FRAME_ALLOCATOR_POISON
+			std::memset(block->Memory.get(), PoisonByte, block->Used.load(std::memory_order_relaxed));
+#endif
+			block->Used.store(0, std::memory_order_relaxed);
+		}
+		buffer.CurrentBlock = 0;
+		m_Block.store(buffer.Blocks[0].get(), std::memory_order_release);
+	}
+
+	FrameAllocatorStats FrameAllocator::GetStats() const {
+		return m_LastFrameStats;
+	}
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Hazel/Core.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Freed frame memory is overwritten with PoisonByte in Debug, so that anything still reading it after its frame reads garbage that's
+// easy to recognise, rather than data that happens to still be right.
+#if defined(HZ_DEBUG) && !defined(HZ_FRAME_ALLOCATOR_POISON)
+	#define HZ_FRAME_ALLOCATOR_POISON 1
+#endif
+
+
+namespace Hazel {
+
+	struct FrameAllocatorStats {
+
+		uint32_t Allocations = 0;	// in the last frame
+		size_t Used = 0;			// bytes, in the last frame (alignment padding included)
+		size_t Capacity = 0;		// bytes, of both frames' blocks
+		size_t HighWater = 0;		// the most bytes any frame has used so far
+		uint32_t Overflows = 0;		// blocks added, since the start. (each one is a heap allocation)
+	};
+
+
+	class FrameAllocator {
+	// Scratch memory that only lives for a frame or two: allocating is bumping a pointer, and there's no freeing, everything goes at
+	// once when the frame it was allocated in is two frames old. Application::Run calls NextFrame() at the start of every frame, so
+	// memory allocated during frame N is still valid during frame N + 1, (eg. for something the next frame reads back) and reused in N + 2.
+	// Nothing allocated here is ever destructed, hence New() only taking trivially destructible types. Containers that only need
+	// their memory for the frame use FrameStlAllocator below. (FrameVector, FrameString, ...)
+	// Allocate() is thread-safe, and lock-free unless the current block is full. NextFrame() is for the main thread, between frames,
+	// when nothing else is allocating. Data for render commands goes through RenderThread::Copy() instead, since with more than one
+	// frame in flight they can run later than this memory lives.
+	public:
+
+		static constexpr size_t BlockSize = 1024 * 1024;
+		static constexpr uint8_t PoisonByte = 0xDD;
+
+		FrameAllocator(size_t blockSize = BlockSize);
+		~FrameAllocator() = default;
+
+		FrameAllocator(const FrameAllocator&) = delete;
+		FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+		static FrameAllocator& Get();
+
+		// Never nullptr: a frame that doesn't fit gets another block, which is kept for the frames after it.
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		template<typename T, typename... Args>
+		T* New(Args&&... args) {
+
+			static_assert(std::is_trivially_destructible_v<T>, "Frame memory is never destructed, T can't own any resources");
+			return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		T* NewArray(size_t count) {
+
+			static_assert(std::is_trivially_destructible_v<T>, "Frame memory is never destructed, T can't own any resources");
+			T* array = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+			for (size_t i = 0; i < count; i++)
+				new (array + i) T();
+			return array;
+		}
+
+		// A null terminated copy, for strings that only need to outlive the call that built them. (labels, log lines, etc.)
+		const char* Copy(std::string_view string);
+
+		// Swaps to the other frame's memory, which is two frames old by now, and starts it over. (poisoning it first, see above)
+		void NextFrame();
+
+		// Of the last finished frame, the one in progress is still being counted.
+		FrameAllocatorStats GetStats() const;
+		inline uint64_t GetFrameIndex() const { return m_FrameIndex; }
+
+	private:
+
+		struct Block {
+
+			std::unique_ptr<uint8_t[]> Memory;
+			size_t Capacity = 0;
+			std::atomic<size_t> Used = 0;
+		};
+
+		// One per frame in flight. Blocks are kept, so that after a couple of frames the memory a frame needs is all there already.
+		struct Buffer {
+
+			std::vector<std::unique_ptr<Block>> Blocks;
+			size_t CurrentBlock = 0;
+		};
+
+		// Called when block (the current one, as seen by the caller) doesn't have size bytes left. Moves on to the next block.
+		void Grow(Block* block, size_t size);
+		size_t GetUsed(const Buffer& buffer) const;
+
+	private:
+
+		size_t m_BlockSize;
+		Buffer m_Buffers[2];
+		uint32_t m_CurrentBuffer = 0;
+		uint64_t m_FrameIndex = 0;
+
+		std::atomic<Block*> m_Block; // current block of the current buffer
+		std::mutex m_GrowMutex;
+
+		std::atomic<uint32_t> m_Allocations = 0;
+		uint32_t m_Overflows = 0;
+		FrameAllocatorStats m_LastFrameStats;
+	};
+
+
+	template<typename T>
+	class FrameStlAllocator {
+	// For standard containers that only live for the frame, eg. FrameVector<DrawPacket*> visible. deallocate() does nothing, memory
+	// a container gives back while growing stays used until the frame's memory goes. reserve() what you can.
+	// The engine's FrameAllocator unless given another one.
+	public:
+
+		using value_type = T;
+
+		FrameStlAllocator() noexcept
+			: m_Allocator(&FrameAllocator::Get())
+		{}
+
+		FrameStlAllocator(FrameAllocator& allocator) noexcept
+			: m_Allocator(&allocator)
+		{}
+
+		template<typename U>
+		FrameStlAllocator(const FrameStlAllocator<U>& other) noexcept
+			: m_Allocator(other.m_Allocator)
+		{}
+
+		T* allocate(size_t count) { return static_cast<T*>(m_Allocator->Allocate(count * sizeof(T), alignof(T))); }
+		void deallocate(T*, size_t) noexcept {}
+
+		template<typename U>
+		bool operator==(const FrameStlAllocator<U>& other) const noexcept { return m_Allocator == other.m_Allocator; }
+		template<typename U>
+		bool operator!=(const FrameStlAllocator<U>& other) const noexcept { return m_Allocator != other.m_Allocator; }
+
+	private:
+
+		template<typename U>
+		friend class FrameStlAllocator;
+
+		FrameAllocator* m_Allocator;
+	};
+
+	template<typename T>
+	using FrameVector = std::vector<T, FrameStlAllocator<T>>;
+
+	using FrameString = std::basic_string<char, std::char_traits<char>, FrameStlAllocator<char>>;
+	using FrameStringStream = std::basic_ostringstream<char, std::char_traits<char>, FrameStlAllocator<char>>;
+}
@@ -0,0 +1,311 @@
+#include "hzpch.h"
+#include "PoolAllocator.h"
+
+#include "Hazel/Memory/AllocationTracker.h"
+
+#include <cstdlib>
+
+
+namespace Hazel {
+
+	// At the start of every chunk, in the blocks before m_FirstBlock.
+	struct ChunkHeader {
+
+		uint32_t Index; // in m_Chunks
+		AllocationTag Tag;
+		bool Tracked; // counted by the AllocationTracker, which has to hear about it going too
+	};
+
+	static_assert(sizeof(ChunkHeader) <= BlockPool::ChunkHeaderSize, "The chunk header doesn't fit");
+
+	static uint32_t Log2(uint32_t value) {
+
+		uint32_t shift = 0;
+		while ((1u << shift) < value)
+			shift++;
+		return shift;
+	}
+
+	// From the platform's aligned allocator rather than operator new, whose allocation tracking header would sit a whole ChunkSize in
+	// front of the chunk, doubling what every chunk takes. The chunk is counted by hand instead. (AllocationTracker::RecordAllocation())
+	static uint8_t* AllocateChunk() {
+
+#ifdef HZ_PLATFORM_WINDOWS
+		void* chunk = _aligned_malloc(BlockPool::ChunkSize, BlockPool::ChunkSize);
+#else
+		void* chunk = std::aligned_alloc(BlockPool::ChunkSize, BlockPool::ChunkSize);
+#endif
+		if (!chunk)
+			throw std::bad_alloc();
+
+		ChunkHeader* header = reinterpret_cast<ChunkHeader*>(chunk);
+		header->Tag = AllocationTracker::GetThreadTag();
+		header->Tracked = AllocationTracker::RecordAllocation(BlockPool::ChunkSize, header->Tag);
+		return static_cast<uint8_t*>(chunk);
+	}
+
+	static void FreeChunk(uint8_t* chunk) {
+
+		const ChunkHeader* header = reinterpret_cast<const ChunkHeader*>(chunk);
+		if (header->Tracked)
+			AllocationTracker::RecordFree(BlockPool::ChunkSize, header->Tag);
+
+#ifdef HZ_PLATFORM_WINDOWS
+		_aligned_free(chunk);
+#else
+		std::free(chunk);
+#endif
+	}
+
+	BlockPool::BlockPool(uint32_t blockSize)
+		: m_BlockShift(Log2(blockSize)), m_ChunkShift(Log2(ChunkSize) - m_BlockShift), m_BlocksPerChunk(ChunkSize / blockSize),
+		m_FirstBlock((ChunkHeaderSize + blockSize - 1) / blockSize) {
+
+		HZ_CORE_ASSERT((1u << m_BlockShift) == blockSize && blockSize >= sizeof(FreeBlock), "Blocks must be a power of two, and hold a FreeBlock!");
+	}
+
+	BlockPool::~BlockPool() {
+
+		uint32_t chunkCount = m_ChunkCount.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < chunkCount; i++)
+			FreeChunk(m_Chunks[i].load(std::memory_order_relaxed));
+	}
+
+	BlockPool::FreeBlock* BlockPool::GetBlock(uint32_t index) const {
+
+		uint8_t* chunk = m_Chunks[index >> m_ChunkShift].load(std::memory_order_acquire);
+		return reinterpret_cast<FreeBlock*>(chunk + ((index & (m_BlocksPerChunk - 1)) << m_BlockShift));
+	}
+
+	uint32_t BlockPool::GetIndex(const void* block) const {
+
+		uintptr_t address = (uintptr_t)block;
+		const uint8_t* chunk = (const uint8_t*)(address & ~(uintptr_t)(ChunkSize - 1));
+		uint32_t chunkIndex = reinterpret_cast<const ChunkHeader*>(chunk)->Index;
+		HZ_CORE_ASSERT(m_Chunks[chunkIndex].load(std::memory_order_relaxed) == chunk, "Block wasn't allocated from this pool!");
+
+		return (chunkIndex << m_ChunkShift) | (uint32_t)((address - (uintptr_t)chunk) >> m_BlockShift);
+	}
+
+	BlockPool::FreeBlock* BlockPool::PopBatch(uint32_t& count) {
+
+		uint64_t head = m_Head.load(std::memory_order_acquire);
+		for (;;) {
+
+			uint32_t index = (uint32_t)head;
+			if (index == EndOfList) {
+				if (!Grow())
+					throw std::bad_alloc();
+				head = m_Head.load(std::memory_order_acquire);
+				continue;
+			}
+
+			// The batch can be popped by another thread between reading its NextBatch and the compare-and-swap, and even be in use by
+			// then, in which case NextBatch is garbage. The counter in the head has changed though, so the compare-and-swap fails.
+			FreeBlock* block = GetBlock(index - 1);
+			uint32_t next = block->NextBatch.load(std::memory_order_relaxed);
+			uint64_t newHead = (((head >> 32) + 1) << 32) | next;
+			if (m_Head.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire)) {
+				count = block->Count;
+				m_Used.fetch_add(count, std::memory_order_relaxed);
+				return block;
+			}
+		}
+	}
+
+	void BlockPool::PushBatch(FreeBlock* first, FreeBlock* last, uint32_t count) {
+
+		last->Next = nullptr;
+		first->Count = count;
+
+		uint32_t index = GetIndex(first) + 1;
+		uint64_t head = m_Head.load(std::memory_order_relaxed);
+		uint64_t newHead;
+		do {
+			first->NextBatch.store((uint32_t)head, std::memory_order_relaxed);
+			newHead = (((head >> 32) + 1) << 32) | index;
+		} while (!m_Head.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+
+		m_Used.fetch_sub(count, std::memory_order_relaxed);
+	}
+
+	bool BlockPool::Grow() {
+
+		std::lock_guard<std::mutex> lock(m_GrowMutex);
+
+		// Freed batches, or another thread's chunk, while this one was waiting for the lock.
+		if ((uint32_t)m_Head.load(std::memory_order_acquire) != EndOfList)
+			return true;
+
+		uint32_t chunkIndex = m_ChunkCount.load(std::memory_order_relaxed);
+		HZ_CORE_ASSERT(chunkIndex < MaxChunks, "BlockPool is out of chunks!");
+		if (chunkIndex >= MaxChunks)
+			return false;
+
+		uint8_t* chunk = AllocateChunk();
+		reinterpret_cast<ChunkHeader*>(chunk)->Index = chunkIndex;
+		m_Chunks[chunkIndex].store(chunk, std::memory_order_release);
+		m_ChunkCount.store(chunkIndex + 1, std::memory_order_release);
+
+		// The chunk's blocks, in batches linked in order, go in front of whatever has been freed since the check above.
+		uint32_t firstIndex = (chunkIndex << m_ChunkShift) | m_FirstBlock;
+		uint32_t endIndex = (chunkIndex << m_ChunkShift) | (m_BlocksPerChunk - 1);
+		FreeBlock* lastBatch = nullptr;
+		for (uint32_t batch = firstIndex; batch <= endIndex; batch += BatchSize) {
+
+			uint32_t count = std::min(BatchSize, endIndex - batch + 1);
+			for (uint32_t i = 0; i < count; i++)
+				GetBlock(batch + i)->Next = i + 1 < count ? GetBlock(batch + i + 1) : nullptr;
+
+			lastBatch = GetBlock(batch);
+			lastBatch->Count = count;
+			lastBatch->NextBatch.store(batch + BatchSize + 1, std::memory_order_relaxed);
+		}
+
+		uint64_t head = m_Head.load(std::memory_order_relaxed);
+		uint64_t newHead;
+		do {
+			lastBatch->NextBatch.store((uint32_t)head, std::memory_order_relaxed);
+			newHead = (((head >> 32) + 1) << 32) | (firstIndex + 1);
+		} while (!m_Head.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+
+		return true;
+	}
+
+	// PoolAllocator ---------------------------------------------------------------------------------------------------------------------
+
+	// Trivially destructible, so that it's still there for whatever is freed after the thread's ThreadCacheFlusher has run.
+	struct ThreadCache {
+
+		struct List {
+
+			BlockPool::FreeBlock* Head;
+			uint32_t Count;
+		};
+
+		List Lists[PoolAllocator::SizeClassCount];
+		bool Exited; // the cache has been flushed for good, blocks go straight to and from the pools
+	};
+
+	struct ThreadCacheFlusher {
+
+		~ThreadCacheFlusher();
+	};
+
+	static thread_local ThreadCache t_Cache;
+	static thread_local ThreadCacheFlusher t_Flusher;
+
+	ThreadCacheFlusher::~ThreadCacheFlusher() {
+
+		PoolAllocator::Get().FlushThreadCache();
+		t_Cache.Exited = true;
+	}
+
+	// The flusher is only constructed, (and so destroyed) on the threads that touch it, which all the ones with a cache do.
+	static inline void RegisterThreadCache() {
+		(void)&t_Flusher;
+	}
+
+	PoolAllocator::PoolAllocator() {
+
+		for (uint32_t i = 0; i < SizeClassCount; i++)
+			m_Pools[i] = new BlockPool(SizeClasses[i]);
+	}
+
+	PoolAllocator& PoolAllocator::Get() {
+
+		static PoolAllocator* instance = new PoolAllocator();
+		return *instance;
+	}
+
+	void* PoolAllocator::Allocate(size_t size) {
+
+		if (size > MaxBlockSize)
+			return ::operator new(size);
+
+		uint32_t sizeClass = GetSizeClass(size);
+		ThreadCache::List& list = t_Cache.Lists[sizeClass];
+		if (!list.Head) {
+
+			uint32_t count;
+			BlockPool::FreeBlock* batch = m_Pools[sizeClass]->PopBatch(count);
+			if (t_Cache.Exited) {
+				if (count > 1)
+					m_Pools[sizeClass]->PushBatch(batch->Next, GetLast(batch), count - 1);
+				return batch;
+			}
+
+			RegisterThreadCache();
+			list.Head = batch;
+			list.Count = count;
+		}
+
+		BlockPool::FreeBlock* block = list.Head;
+		list.Head = block->Next;
+		list.Count--;
+		return block;
+	}
+
+	void PoolAllocator::Free(void* memory, size_t size) {
+
+		if (!memory)
+			return;
+
+		if (size > MaxBlockSize) {
+			::operator delete(memory);
+			return;
+		}
+
+		uint32_t sizeClass = GetSizeClass(size);
+		BlockPool::FreeBlock* block = static_cast<BlockPool::FreeBlock*>(memory);
+		if (t_Cache.Exited) {
+			m_Pools[sizeClass]->PushBatch(block, block, 1);
+			return;
+		}
+
+		ThreadCache::List& list = t_Cache.Lists[sizeClass];
+		if (list.Count == 0)
+			RegisterThreadCache();
+
+		block->Next = list.Head;
+		list.Head = block;
+		list.Count++;
+
+		// Two batches' worth, one goes back, so that blocks freed on a thread that doesn't allocate them (or not as many) don't pile up.
+		if (list.Count == 2 * BlockPool::BatchSize) {
+
+			BlockPool::FreeBlock* last = list.Head;
+			for (uint32_t i = 1; i < BlockPool::BatchSize; i++)
+				last = last->Next;
+
+			BlockPool::FreeBlock* rest = last->Next;
+			m_Pools[sizeClass]->PushBatch(list.Head, last, BlockPool::BatchSize);
+			list.Head = rest;
+			list.Count -= BlockPool::BatchSize;
+		}
+	}
+
+	void PoolAllocator::FlushThreadCache() {
+
+		for (uint32_t i = 0; i < SizeClassCount; i++) {
+
+			ThreadCache::List& list = t_Cache.Lists[i];
+			if (list.Head)
+				m_Pools[i]->PushBatch(list.Head, GetLast(list.Head), list.Count);
+			list = {};
+		}
+	}
+
+	BlockPool::FreeBlock* PoolAllocator::GetLast(BlockPool::FreeBlock* block) {
+
+		while (block->Next)
+			block = block->Next;
+		return block;
+	}
+
+	PoolStats PoolAllocator::GetStats(uint32_t sizeClass) const {
+
+		const BlockPool& pool = *m_Pools[sizeClass];
+		return { pool.GetBlockSize(), pool.GetUsed(), pool.GetCapacity(), pool.GetChunkCount() };
+	}
+}
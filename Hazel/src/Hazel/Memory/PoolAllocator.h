@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Hazel/Core.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+
+namespace Hazel {
+
+	class BlockPool {
+	// Fixed size blocks, carved out of ChunkSize chunks that are only ever added, (never given back until the pool goes) with the free
+	// blocks in a lock-free list of batches: popping or pushing a whole batch is one compare-and-swap, from any thread, only adding a
+	// chunk takes a lock. Blocks are handed out a batch at a time to the PoolAllocator's per thread caches, not one by one.
+	// The list head is a block index and a counter that changes on every push and pop, so a batch that's popped and pushed back by
+	// another thread in between can't fool a compare-and-swap. (the ABA problem)
+	public:
+
+		static constexpr uint32_t ChunkSize = 64 * 1024;	// chunks are aligned to their size, that's how a block's chunk is found
+		static constexpr uint32_t ChunkHeaderSize = 64;
+		static constexpr uint32_t MaxChunks = 4096;
+		static constexpr uint32_t BatchSize = 32;			// blocks, except for a chunk's last batch, and what a thread gives back as it exits
+
+		// What's written into a free block. Next links the blocks of a batch, (and of a thread's cache) the rest is only used in the
+		// first block of a batch.
+		struct FreeBlock {
+
+			FreeBlock* Next;
+			std::atomic<uint32_t> NextBatch;	// index + 1 of the first block of the next batch in the list
+			uint32_t Count;						// blocks in the batch
+		};
+
+		BlockPool(uint32_t blockSize);	// a power of two, at least sizeof(FreeBlock)
+		~BlockPool();
+
+		BlockPool(const BlockPool&) = delete;
+		BlockPool& operator=(const BlockPool&) = delete;
+
+		// A batch of free blocks, linked through FreeBlock::Next, and its block count in count. Adds a chunk when there are none left.
+		FreeBlock* PopBatch(uint32_t& count);
+		// count blocks, from first to last through FreeBlock::Next, back into the list as one batch.
+		void PushBatch(FreeBlock* first, FreeBlock* last, uint32_t count);
+
+		inline uint32_t GetBlockSize() const { return 1u << m_BlockShift; }
+		inline uint32_t GetChunkCount() const { return m_ChunkCount.load(std::memory_order_acquire); }
+		inline uint32_t GetCapacity() const { return GetChunkCount() * (m_BlocksPerChunk - m_FirstBlock); }
+		inline uint32_t GetUsed() const { return (uint32_t)m_Used.load(std::memory_order_relaxed); }
+
+	private:
+
+		// Block indices in the list are + 1, so that 0 is the end of the list.
+		static constexpr uint32_t EndOfList = 0;
+
+		// A block's index is its chunk's index, then its place in the chunk, so both are a shift and a mask away, no divisions.
+		FreeBlock* GetBlock(uint32_t index) const;
+		uint32_t GetIndex(const void* block) const;
+
+		// Adds a chunk, unless another thread has refilled the list meanwhile. false when there's no room for another chunk.
+		bool Grow();
+
+	private:
+
+		uint32_t m_BlockShift;
+		uint32_t m_ChunkShift;		// blocks per chunk, as a shift
+		uint32_t m_BlocksPerChunk;
+		uint32_t m_FirstBlock;		// in each chunk, the ones before it hold the chunk header
+
+		std::atomic<uint64_t> m_Head{ 0 }; // counter in the high 32 bits, index + 1 of the first block of the first batch in the low ones
+		std::atomic<uint8_t*> m_Chunks[MaxChunks] = {};
+		std::atomic<uint32_t> m_ChunkCount{ 0 };
+		std::atomic<int32_t> m_Used{ 0 };
+		std::mutex m_GrowMutex;
+	};
+
+
+	struct PoolStats {
+
+		uint32_t BlockSize = 0;
+		uint32_t Used = 0;		// blocks, including the ones sitting in threads' caches
+		uint32_t Capacity = 0;	// blocks
+		uint32_t Chunks = 0;
+	};
+
+
+	class PoolAllocator {
+	// A BlockPool per size class, for small objects that are created and destroyed all the time, from any thread: events that have to
+	// outlive the callback that made them, layers, renderer resource handles. Anything bigger than MaxBlockSize goes to operator new.
+	// Each thread keeps up to two batches of free blocks per size class, so most Allocate() and Free() calls don't touch anything
+	// shared, and a block can be freed by any thread, not just the one that allocated it. A thread's blocks go back to the pools when it exits.
+	// Free() needs the size the memory was allocated with, which a class' sized operator delete gets. (see HZ_POOL_ALLOCATED)
+	// Blocks are aligned to 16 bytes, (alignof(std::max_align_t)) over-aligned types don't belong in here.
+	public:
+
+		static constexpr uint32_t SizeClassCount = 5;
+		static constexpr uint32_t SizeClasses[SizeClassCount] = { 16, 32, 64, 128, 256 };
+		static constexpr uint32_t MaxBlockSize = SizeClasses[SizeClassCount - 1];
+
+		// Never destroyed, pooled objects can be freed by other statics' destructors at exit, in any order.
+		static PoolAllocator& Get();
+
+		void* Allocate(size_t size);
+		void Free(void* memory, size_t size);
+
+		PoolStats GetStats(uint32_t sizeClass) const;
+
+		// The calling thread's cached blocks, back into the pools. Happens by itself when a thread exits.
+		void FlushThreadCache();
+
+	private:
+
+		// Get() only, the threads' caches are for the one PoolAllocator.
+		PoolAllocator();
+
+		static inline uint32_t GetSizeClass(size_t size) {
+
+			uint32_t sizeClass = 0;
+			while (SizeClasses[sizeClass] < size)
+				sizeClass++;
+			return sizeClass;
+		}
+
+		static BlockPool::FreeBlock* GetLast(BlockPool::FreeBlock* block);
+
+	private:
+
+		BlockPool* m_Pools[SizeClassCount];
+	};
+}
+
+// Inside a class: objects of it, and of its subclasses, are allocated from the PoolAllocator. Deleting through a base class pointer
+// needs a virtual destructor, like it always does, that's also what gives operator delete the size of the actual object.
+// Placement new stays available, (eg. FrameAllocator::New()) it would be hidden by the class' own operator new otherwise.
+#define HZ_POOL_ALLOCATED()\
+	static void* operator new(size_t size) { return ::Hazel::PoolAllocator::Get().Allocate(size); }\
+	static void operator delete(void* memory, size_t size) { ::Hazel::PoolAllocator::Get().Free(memory, size); }\
+	static void* operator new(size_t, void* place) noexcept { return place; }\
+	static void operator delete(void*, void*) noexcept {}
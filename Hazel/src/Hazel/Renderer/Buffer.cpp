@@ -0,0 +1,63 @@
+#include "hzpch.h"
+#include "Buffer.h"
+
+#include "Hazel/Renderer/RendererAPI.h"
+
+#include "Platform/OpenGL/OpenGLBuffer.h"
+#include "Platform/Null/NullBuffer.h"
+
+
+namespace Hazel {
+
+	VertexBuffer* VertexBuffer::Create(float* vertices, uint32_t size) {
+
+		switch (RendererAPI::GetAPI()) {
+
+			case RendererAPI::API::None:	HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:	return new OpenGLVertexBuffer(vertices, size);
+			case RendererAPI::API::Null:	return new NullVertexBuffer(vertices, size);
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	VertexBuffer* VertexBuffer::Create(uint32_t size) {
+
+		switch (RendererAPI::GetAPI()) {
+
+			case RendererAPI::API::None:	HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:	return new OpenGLVertexBuffer(size);
+			case RendererAPI::API::Null:	return new NullVertexBuffer(size);
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	StreamingVertexBuffer* StreamingVertexBuffer::Create(uint32_t segmentSize, uint32_t segmentCount) {
+
+		switch (RendererAPI::GetAPI()) {
+
+			case RendererAPI::API::None:	HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:	return new OpenGLStreamingVertexBuffer(segmentSize, segmentCount);
+			case RendererAPI::API::Null:	return new NullStreamingVertexBuffer(segmentSize, segmentCount);
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	IndexBuffer* IndexBuffer::Create(uint32_t* indices, uint32_t count) {
+
+		switch (RendererAPI::GetAPI()) {
+
+			case RendererAPI::API::None:	HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:	return new OpenGLIndexBuffer(indices, count);
+			case RendererAPI::API::Null:	return new NullIndexBuffer(indices, count);
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Hazel/Core.h"
+#include "Hazel/Memory/PoolAllocator.h"
+
+#include <string>
+#include <vector>
+
+
+namespace Hazel {
+
+	enum class ShaderDataType {
+		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+	};
+
+	static uint32_t ShaderDataTypeSize(ShaderDataType type) {
+
+		switch (type) {
+
+			case ShaderDataType::Float:		return 4;
+			case ShaderDataType::Float2:	return 4 * 2;
+			case ShaderDataType::Float3:	return 4 * 3;
+			case ShaderDataType::Float4:	return 4 * 4;
+			case ShaderDataType::Mat3:		return 4 * 3 * 3;
+			case ShaderDataType::Mat4:		return 4 * 4 * 4;
+			case ShaderDataType::Int:		return 4;
+			case ShaderDataType::Int2:		return 4 * 2;
+			case ShaderDataType::Int3:		return 4 * 3;
+			case ShaderDataType::Int4:		return 4 * 4;
+			case ShaderDataType::Bool:		return 1;
+			default:						break;
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown ShaderDataType!");
+		return 0;
+	}
+
+	struct BufferElement {
+
+		std::string Name;
+		ShaderDataType Type;
+		uint32_t Size;
+		uint32_t Offset;
+		bool Normalized;
+
+		BufferElement() = default;
+
+		BufferElement(ShaderDataType type, const std::string& name, bool normalized = false)
+			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized)
+		{}
+
+		uint32_t GetComponentCount() const {
+
+			switch (Type) {
+
+				case ShaderDataType::Float:		return 1;
+				case ShaderDataType::Float2:	return 2;
+				case ShaderDataType::Float3:	return 3;
+				case ShaderDataType::Float4:	return 4;
+				case ShaderDataType::Mat3:		return 3 * 3;
+				case ShaderDataType::Mat4:		return 4 * 4;
+				case ShaderDataType::Int:		return 1;
+				case ShaderDataType::Int2:		return 2;
+				case ShaderDataType::Int3:		return 3;
+				case ShaderDataType::Int4:		return 4;
+				case ShaderDataType::Bool:		return 1;
+				default:						break;
+			}
+
+			HZ_CORE_ASSERT(false, "Unknown ShaderDataType!");
+			return 0;
+		}
+	};
+
+
+	class BufferLayout {
+	// Describes the vertices of a VertexBuffer, one element per attribute, in order. Offsets and the stride are worked out from the types.
+	// eg. BufferLayout layout = { { ShaderDataType::Float3, "a_Position" }, { ShaderDataType::Float4, "a_Color" } };
+	// A divisor makes the buffer per-instance instead of per-vertex, its attributes then advance once every divisor instances.
+	// eg. BufferLayout instanceLayout({ { ShaderDataType::Mat4, "i_Transform" }, { ShaderDataType::Float4, "i_Color" } }, 1);
+	public:
+
+		BufferLayout() {}
+
+		BufferLayout(const std::initializer_list<BufferElement>& elements, uint32_t divisor = 0)
+			: m_Elements(elements), m_Divisor(divisor)
+		{
+			CalculateOffsetsAndStride();
+		}
+
+		inline uint32_t GetStride() const { return m_Stride; }
+		inline uint32_t GetDivisor() const { return m_Divisor; }
+		inline bool IsPerInstance() const { return m_Divisor != 0; }
+		inline const std::vector<BufferElement>& GetElements() const { return m_Elements; }
+
+		std::vector<BufferElement>::iterator begin() { return m_Elements.begin(); }
+		std::vector<BufferElement>::iterator end() { return m_Elements.end(); }
+		std::vector<BufferElement>::const_iterator begin() const { return m_Elements.begin(); }
+		std::vector<BufferElement>::const_iterator end() const { return m_Elements.end(); }
+
+	private:
+
+		void CalculateOffsetsAndStride() {
+
+			uint32_t offset = 0;
+			m_Stride = 0;
+			for (BufferElement& element : m_Elements) {
+				element.Offset = offset;
+				offset += element.Size;
+				m_Stride += element.Size;
+			}
+		}
+
+	private:
+
+		std::vector<BufferElement> m_Elements;
+		uint32_t m_Stride = 0;
+		uint32_t m_Divisor = 0;
+	};
+
+
+	// Buffers are created through Create(), which picks the implementation of the current RendererAPI::GetAPI().
+	class VertexBuffer {
+
+	public:
+
+		HZ_POOL_ALLOCATED()
+
+		virtual ~VertexBuffer() = default;
+
+		virtual void Bind() const = 0;
+		virtual void Unbind() const = 0;
+
+		// Replaces the first size bytes of the buffer. (for buffers created with a size only, that are filled every frame)
+		virtual void SetData(const void* data, uint32_t size) = 0;
+
+		virtual const BufferLayout& GetLayout() const = 0;
+		virtual void SetLayout(const BufferLayout& layout) = 0;
+
+		static VertexBuffer* Create(float* vertices, uint32_t size);
+		static VertexBuffer* Create(uint32_t size); // dynamic, contents uploaded later through SetData()
+	};
+
+	class StreamingVertexBuffer : public VertexBuffer {
+	// For vertices that are rewritten (many times) every frame, like the Renderer2D's batches. The buffer is a ring of segments, and 
+	// Write() appends to the current one, so data still being read by the GPU is never overwritten. Only blocks when the ring wraps 
+	// around onto a segment the GPU hasn't finished drawing from. (ie. when the GPU is segmentCount - 1 segments behind)
+	public:
+
+		// Copies size bytes (at most segmentSize) into the ring, and returns the byte offset they landed at. Divided by the layout's
+		// stride, that's the base/first vertex to draw them with. Every write should be a whole number of vertices.
+		virtual uint32_t Write(const void* data, uint32_t size) = 0;
+
+		static StreamingVertexBuffer* Create(uint32_t segmentSize, uint32_t segmentCount = 3);
+	};
+
+	class IndexBuffer {
+
+	public:
+
+		HZ_POOL_ALLOCATED()
+
+		virtual ~IndexBuffer() = default;
+
+		virtual void Bind() const = 0;
+		virtual void Unbind() const = 0;
+
+		virtual uint32_t GetCount() const = 0;
+
+		static IndexBuffer* Create(uint32_t* indices, uint32_t count);
+	};
+}
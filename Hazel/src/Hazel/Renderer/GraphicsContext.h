@@ -7,9 +7,15 @@ namespace Hazel {
 	// This class will be an interface, which will be inherited by specific RenderAPIs, such as Vulkan, OpenGL, DirectX, Metal, etc.
 	public:
 
+		virtual ~GraphicsContext() = default; // windows only know their context as a GraphicsContext*, and delete it through that
+
 		virtual void Init() = 0;
 		virtual void SwapBuffers() = 0;
 
+		// Which thread the context is current on, for handing it over to the RenderThread and back.
+		virtual void MakeCurrent() = 0;
+		virtual void ReleaseCurrent() = 0;
+
 
 	};
 }
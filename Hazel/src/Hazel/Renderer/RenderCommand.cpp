@@ -0,0 +1,18 @@
+#include "hzpch.h"
+#include "RenderCommand.h"
+
+
+namespace Hazel {
+
+	std::unique_ptr<RendererAPI> RenderCommand::s_RendererAPI;
+
+	void RenderCommand::Init() {
+
+		s_RendererAPI.reset(RendererAPI::Create());
+		s_RendererAPI->Init();
+	}
+
+	void RenderCommand::Shutdown() {
+		s_RendererAPI.reset();
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Hazel/Renderer/RendererAPI.h"
+
+
+namespace Hazel {
+
+	class RenderCommand {
+	// Static front for the current RendererAPI, created by Init(). (called by the Application, once its context exists)
+	public:
+
+		static void Init();
+		static void Shutdown();
+
+		inline static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) { s_RendererAPI->SetViewport(x, y, width, height); }
+		inline static void SetClearColor(const glm::vec4& color) { s_RendererAPI->SetClearColor(color); }
+		inline static void Clear() { s_RendererAPI->Clear(); }
+		inline static void SetBlendMode(BlendMode mode) { s_RendererAPI->SetBlendMode(mode); }
+
+		inline static void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) { 
+			s_RendererAPI->DrawIndexed(vertexArray, indexCount, baseVertex); 
+		}
+		inline static void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) {
+			s_RendererAPI->DrawIndexedInstanced(vertexArray, instanceCount, indexCount);
+		}
+		inline static void DrawLines(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) {
+			s_RendererAPI->DrawLines(vertexArray, vertexCount, firstVertex);
+		}
+		inline static void SetLineWidth(float width) { s_RendererAPI->SetLineWidth(width); }
+
+		inline static uint32_t GetMaxTextureSlots() { return s_RendererAPI->GetMaxTextureSlots(); }
+
+		inline static void BeginGPUFrame() { s_RendererAPI->BeginGPUFrame(); }
+		inline static void EndGPUFrame() { s_RendererAPI->EndGPUFrame(); }
+		inline static void BeginGPUScope(const char* name) { s_RendererAPI->BeginGPUScope(name); }
+		inline static void EndGPUScope() { s_RendererAPI->EndGPUScope(); }
+
+		inline static void LogShaderCacheStats() { s_RendererAPI->LogShaderCacheStats(); }
+
+		inline static RendererAPI& GetRendererAPI() { return *s_RendererAPI; }
+
+	private:
+
+		static std::unique_ptr<RendererAPI> s_RendererAPI;
+	};
+
+
+	class GPUScope {
+	// RAII GPU scope, see HZ_PROFILE_GPU_SCOPE
+	public:
+
+		GPUScope(const char* name) { RenderCommand::BeginGPUScope(name); }
+		~GPUScope() { RenderCommand::EndGPUScope(); }
+	};
+}
+
+
+// Same switch as the CPU profiler, (see Instrumentor.h) compiled out in Dist.
+#if HZ_PROFILE
+	#define HZ_PROFILE_GPU_SCOPE(name) ::Hazel::GPUScope HZ_PROFILE_CONCAT(gpuScope, __LINE__)(name)
+#else
+	#define HZ_PROFILE_GPU_SCOPE(name)
+#endif
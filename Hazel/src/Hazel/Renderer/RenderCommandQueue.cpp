@@ -0,0 +1,69 @@
+#include "hzpch.h"
+#include "RenderCommandQueue.h"
+
+
+namespace Hazel {
+
+	RenderCommandQueue::~RenderCommandQueue() {
+		Reset(false);
+	}
+
+	void* RenderCommandQueue::AllocateData(uint32_t size) {
+		return Allocate(nullptr, size);
+	}
+
+	void RenderCommandQueue::Execute() {
+
+		HZ_PROFILE_FUNCTION();
+		Reset(true);
+	}
+
+	void* RenderCommandQueue::Allocate(CommandFn fn, uint32_t size) {
+
+		uint32_t paddedSize = (size + Alignment - 1) & ~(Alignment - 1);
+		uint32_t total = (uint32_t)sizeof(Header) + paddedSize;
+
+		if (m_Blocks.empty())
+			m_Blocks.push_back({ std::make_unique<uint8_t[]>(BlockSize), BlockSize });
+
+		if (m_Blocks[m_CurrentBlock].Used + total > m_Blocks[m_CurrentBlock].Capacity) {
+
+			// Moves on to the next block, unless it's too small for this allocation, then a big enough one goes in before it.
+			m_CurrentBlock++;
+			if (m_CurrentBlock == m_Blocks.size() || m_Blocks[m_CurrentBlock].Capacity < total) {
+				uint32_t capacity = total > BlockSize ? total : BlockSize;
+				m_Blocks.insert(m_Blocks.begin() + m_CurrentBlock, { std::make_unique<uint8_t[]>(capacity), capacity });
+			}
+		}
+
+		Block& block = m_Blocks[m_CurrentBlock];
+		Header* header = reinterpret_cast<Header*>(block.Memory.get() + block.Used);
+		header->Fn = fn;
+		header->Size = paddedSize;
+
+		block.Used += total;
+		m_Size += total;
+		return header + 1;
+	}
+
+	void RenderCommandQueue::Reset(bool execute) {
+
+		for (uint32_t i = 0; i <= m_CurrentBlock && i < m_Blocks.size(); i++) {
+
+			Block& block = m_Blocks[i];
+			uint32_t offset = 0;
+			while (offset < block.Used) {
+
+				Header* header = reinterpret_cast<Header*>(block.Memory.get() + offset);
+				if (header->Fn)
+					header->Fn(header + 1, execute);
+				offset += (uint32_t)sizeof(Header) + header->Size;
+			}
+			block.Used = 0;
+		}
+
+		m_CurrentBlock = 0;
+		m_CommandCount = 0;
+		m_Size = 0;
+	}
+}
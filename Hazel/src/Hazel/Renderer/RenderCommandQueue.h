@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Hazel/Core.h"
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+
+namespace Hazel {
+
+	class RenderCommandQueue {
+	// Commands (any callable, usually a lambda) packed one after the other into large blocks of memory, together with the data they
+	// read, and run in submission order by Execute(). Once the blocks have grown to the size of a frame, recording a command is a
+	// placement new and nothing else. Blocks are kept between frames, a command bigger than BlockSize gets a block of its own.
+	// Not thread-safe by itself, the RenderThread makes sure a queue is only ever recorded into or executed by one thread at a time.
+	public:
+
+		static constexpr uint32_t BlockSize = 1024 * 1024;
+
+		RenderCommandQueue() = default;
+		~RenderCommandQueue(); // destroys the commands that never ran, without running them
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		template<typename F>
+		void Submit(F&& command) {
+
+			using Command = std::decay_t<F>;
+			static_assert(alignof(Command) <= Alignment, "Render command is over-aligned!");
+
+			void* memory = Allocate(&Run<Command>, (uint32_t)sizeof(Command));
+			new (memory) Command(std::forward<F>(command));
+			m_CommandCount++;
+		}
+
+		// size bytes that stay valid until the queue has been executed, for the data of a command. (vertices, uniforms, etc.)
+		void* AllocateData(uint32_t size);
+
+		// Runs every command in the order they were submitted, then empties the queue.
+		void Execute();
+
+		inline bool IsEmpty() const { return m_CommandCount == 0 && m_Size == 0; }
+		inline uint32_t GetCommandCount() const { return m_CommandCount; }
+		inline uint32_t GetSize() const { return m_Size; } // bytes of commands and data recorded
+
+	private:
+
+		static constexpr uint32_t Alignment = 16;
+
+		// Runs the command and destroys it, or only destroys it when execute is false.
+		using CommandFn = void(*)(void* command, bool execute);
+
+		template<typename Command>
+		static void Run(void* memory, bool execute) {
+
+			Command& command = *static_cast<Command*>(memory);
+			if (execute)
+				command();
+			command.~Command();
+		}
+
+		// In front of every allocation. Data allocations have no Fn, and are skipped over.
+		struct alignas(Alignment) Header {
+
+			CommandFn Fn;
+			uint32_t Size; // of what follows, rounded up to Alignment
+		};
+
+		struct Block {
+
+			std::unique_ptr<uint8_t[]> Memory;
+			uint32_t Capacity = 0;
+			uint32_t Used = 0;
+		};
+
+		void* Allocate(CommandFn fn, uint32_t size);
+		void Reset(bool execute);
+
+	private:
+
+		std::vector<Block> m_Blocks;
+		uint32_t m_CurrentBlock = 0;
+		uint32_t m_CommandCount = 0;
+		uint32_t m_Size = 0;
+	};
+}
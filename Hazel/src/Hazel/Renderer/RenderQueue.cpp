@@ -0,0 +1,182 @@
+#include "hzpch.h"
+#include "RenderQueue.h"
+
+
+namespace Hazel {
+
+	static inline uint64_t Bits(uint64_t value, uint32_t bits, uint32_t shift) {
+		return (value & ((1ull << bits) - 1)) << shift;
+	}
+
+	static inline uint64_t QuantiseDepth(float depth, uint32_t bits) {
+
+		depth = std::min(std::max(depth, 0.0f), 1.0f);
+		return (uint64_t)(depth * (float)((1ull << bits) - 1));
+	}
+
+	uint32_t RenderQueue::GetResourceID(const void* resource) {
+
+		if (!resource)
+			return 0;
+
+		auto [it, inserted] = m_ResourceIDs.try_emplace(resource, (uint32_t)m_ResourceIDs.size() + 1);
+		return it->second;
+	}
+
+	// IDs past what their field holds wrap around, which only means those draws aren't grouped as well. The order is still the same 
+	// every time, for the same submissions.
+	uint64_t RenderQueue::MakeSortKey(const DrawPacket& packet) {
+
+		uint64_t shader = GetResourceID(packet.Program.get());
+		uint64_t texture = GetResourceID(packet.Material.get());
+		uint64_t vertexArray = GetResourceID(packet.Mesh.get());
+
+		uint64_t key = Bits(packet.Pass, 8, 56);
+		if (packet.Blend == BlendMode::Opaque) {
+
+			key |= Bits(shader, 12, 43);
+			key |= Bits(texture, 12, 31);
+			key |= Bits(vertexArray, 12, 19);
+			key |= Bits(QuantiseDepth(packet.Depth, 19), 19, 0);
+		}
+		else {
+
+			key |= 1ull << 55;
+			key |= Bits((1ull << 24) - 1 - QuantiseDepth(packet.Depth, 24), 24, 31);
+			key |= Bits((uint64_t)packet.Blend, 3, 28);
+			key |= Bits(shader, 10, 18);
+			key |= Bits(texture, 10, 8);
+			key |= Bits(vertexArray, 8, 0);
+		}
+		return key;
+	}
+
+	void RenderQueue::Submit(const DrawPacket& packet) {
+
+		HZ_CORE_ASSERT(packet.Program && packet.Mesh, "A DrawPacket needs a shader and a vertex array!");
+
+		m_SortEntries.push_back({ MakeSortKey(packet), (uint32_t)m_Packets.size() });
+		m_Packets.push_back(packet);
+
+		// What executing in this order would have cost, to compare the sorted order with.
+		if (packet.Program.get() != m_SubmittedShader)
+			m_SubmissionOrderBinds++;
+		if (packet.Material && packet.Material.get() != m_SubmittedTexture)
+			m_SubmissionOrderBinds++;
+		if (packet.Mesh.get() != m_SubmittedVertexArray)
+			m_SubmissionOrderBinds++;
+
+		m_SubmittedShader = packet.Program.get();
+		m_SubmittedTexture = packet.Material ? packet.Material.get() : m_SubmittedTexture;
+		m_SubmittedVertexArray = packet.Mesh.get();
+	}
+
+	// LSD radix sort, a byte at a time. Stable, so packets with the same key keep their submission order. Passes where every key has the
+	// same byte (the pass byte, usually, and the high ID bits) are skipped.
+	void RenderQueue::Sort() {
+
+		HZ_PROFILE_FUNCTION();
+
+		size_t count = m_SortEntries.size();
+		if (count < 2)
+			return;
+
+		m_SortScratch.resize(count);
+		SortEntry* source = m_SortEntries.data();
+		SortEntry* destination = m_SortScratch.data();
+
+		for (uint32_t shift = 0; shift < 64; shift += 8) {
+
+			uint32_t offsets[256] = {};
+			for (size_t i = 0; i < count; i++)
+				offsets[(source[i].Key >> shift) & 0xff]++;
+
+			if (offsets[(source[0].Key >> shift) & 0xff] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t& bucket : offsets) {
+				uint32_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (size_t i = 0; i < count; i++)
+				destination[offsets[(source[i].Key >> shift) & 0xff]++] = source[i];
+
+			std::swap(source, destination);
+		}
+
+		if (source != m_SortEntries.data())
+			m_SortEntries.swap(m_SortScratch);
+	}
+
+	void RenderQueue::Execute(const glm::mat4& viewProjection, RendererAPI& api) {
+
+		HZ_PROFILE_FUNCTION();
+
+		m_Stats = RenderQueueStats();
+		m_Stats.Packets = (uint32_t)m_Packets.size();
+		m_Stats.SubmissionOrderBinds = m_SubmissionOrderBinds;
+
+		const Shader* shader = nullptr;
+		const Texture* texture = nullptr;
+		const VertexArray* vertexArray = nullptr;
+		BlendMode blend = BlendMode::Alpha; // what's set between frames (see RendererAPI::Init())
+
+		for (const SortEntry& entry : m_SortEntries) {
+
+			const DrawPacket& packet = m_Packets[entry.Index];
+
+			if (packet.Blend != blend) {
+				blend = packet.Blend;
+				api.SetBlendMode(blend);
+				m_Stats.BlendChanges++;
+			}
+
+			if (packet.Program.get() != shader) {
+				shader = packet.Program.get();
+				packet.Program->Bind();
+				packet.Program->SetMat4("u_ViewProjection", viewProjection);
+				m_Stats.ShaderBinds++;
+			}
+
+			if (packet.Material && packet.Material.get() != texture) {
+				texture = packet.Material.get();
+				packet.Material->Bind(0);
+				m_Stats.TextureBinds++;
+			}
+
+			// Bound by the draw itself.
+			if (packet.Mesh.get() != vertexArray) {
+				vertexArray = packet.Mesh.get();
+				m_Stats.VertexArrayChanges++;
+			}
+
+			packet.Program->SetMat4("u_Transform", packet.Transform);
+
+			if (packet.InstanceCount > 1)
+				api.DrawIndexedInstanced(packet.Mesh, packet.InstanceCount, packet.IndexCount);
+			else
+				api.DrawIndexed(packet.Mesh, packet.IndexCount);
+		}
+
+		if (blend != BlendMode::Alpha)
+			api.SetBlendMode(BlendMode::Alpha);
+
+		uint32_t binds = m_Stats.ShaderBinds + m_Stats.TextureBinds + m_Stats.VertexArrayChanges;
+		m_Stats.BindsAvoided = m_SubmissionOrderBinds > binds ? m_SubmissionOrderBinds - binds : 0;
+	}
+
+	void RenderQueue::Clear() {
+
+		m_Packets.clear();
+		m_SortEntries.clear();
+		m_ResourceIDs.clear();
+
+		m_SubmittedShader = nullptr;
+		m_SubmittedTexture = nullptr;
+		m_SubmittedVertexArray = nullptr;
+		m_SubmissionOrderBinds = 0;
+	}
+}
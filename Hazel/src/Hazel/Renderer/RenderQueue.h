@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Hazel/Renderer/RendererAPI.h"
+#include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/Texture.h"
+
+#include <glm/glm.hpp>
+
+
+namespace Hazel {
+
+	// Everything needed to issue one draw. The material is just a texture for now, bound to slot 0. (nullptr keeps whatever is bound)
+	struct DrawPacket {
+
+		std::shared_ptr<Shader> Program;
+		std::shared_ptr<Texture> Material;
+		std::shared_ptr<VertexArray> Mesh;
+		glm::mat4 Transform = glm::mat4(1.0f);	// set as u_Transform
+
+		float Depth = 0.0f;						// 0 (nearest) to 1 (farthest), opaque draws go front to back, blended ones back to front
+		BlendMode Blend = BlendMode::Opaque;
+		uint8_t Pass = 0;						// passes are drawn in increasing order, eg. world, then overlays
+
+		uint32_t IndexCount = 0;				// 0 draws the whole index buffer
+		uint32_t InstanceCount = 1;
+	};
+
+	struct RenderQueueStats {
+
+		uint32_t Packets = 0;
+		uint32_t ShaderBinds = 0;
+		uint32_t TextureBinds = 0;
+		uint32_t VertexArrayChanges = 0;
+		uint32_t BlendChanges = 0;
+		// The shader, texture and vertex array binds the packets would have needed in the order they were submitted in, and how many
+		// of those sorting saved.
+		uint32_t SubmissionOrderBinds = 0;
+		uint32_t BindsAvoided = 0;
+	};
+
+
+	class RenderQueue {
+	// Draws are submitted as DrawPackets, each with a 64 bit sort key, then radix sorted by key and executed in that order. Going
+	// from the top bit, a key is:
+	//   opaque:  | pass (8) | 0 | shader (12) | texture (12) | vertex array (12) | depth (19)                        |
+	//   blended: | pass (8) | 1 | depth, inverted (24) | blend mode (3) | shader (10) | texture (10) | vertex array (8) |
+	// so opaque draws are grouped by state (fewest rebinds), and blended ones still come after them, back to front. Shaders, textures
+	// and vertex arrays get small IDs in the order they're first seen, since only which draws share them matters.
+	public:
+
+		void Submit(const DrawPacket& packet);
+
+		void Sort();
+		// Binds only what changes from one packet to the next. u_ViewProjection is set whenever the shader changes.
+		void Execute(const glm::mat4& viewProjection, RendererAPI& api);
+		// Forgets the packets (and the IDs), ready for the next frame.
+		void Clear();
+
+		inline uint32_t GetPacketCount() const { return (uint32_t)m_Packets.size(); }
+		inline const DrawPacket& GetPacket(uint32_t index) const { return m_Packets[index]; }
+		// Packet indices in sorted order. (once Sort() has been called)
+		inline uint32_t GetSortedIndex(uint32_t position) const { return m_SortEntries[position].Index; }
+		inline uint64_t GetSortKey(uint32_t position) const { return m_SortEntries[position].Key; }
+
+		// Of the last Execute()
+		inline const RenderQueueStats& GetStats() const { return m_Stats; }
+
+	private:
+
+		uint64_t MakeSortKey(const DrawPacket& packet);
+		uint32_t GetResourceID(const void* resource);
+
+	private:
+
+		struct SortEntry {
+
+			uint64_t Key;
+			uint32_t Index;
+		};
+
+		std::vector<DrawPacket> m_Packets;
+		std::vector<SortEntry> m_SortEntries;
+		std::vector<SortEntry> m_SortScratch;
+
+		std::unordered_map<const void*, uint32_t> m_ResourceIDs;
+
+		// Last state seen by Submit(), for the binds of the submission order.
+		const void* m_SubmittedShader = nullptr;
+		const void* m_SubmittedTexture = nullptr;
+		const void* m_SubmittedVertexArray = nullptr;
+		uint32_t m_SubmissionOrderBinds = 0;
+
+		RenderQueueStats m_Stats;
+	};
+}
@@ -0,0 +1,194 @@
+#include "hzpch.h"
+#include "RenderThread.h"
+
+#include "Hazel/Timer.h"
+#include "Hazel/Memory/AllocationTracker.h"
+
+#include <cstdlib>
+#include <cstring>
+
+
+namespace Hazel {
+
+	static bool GetDefaultEnabled() {
+
+		const char* value = std::getenv("HZ_RENDER_THREAD");
+		return value && std::strcmp(value, "1") == 0;
+	}
+
+	bool RenderThread::s_Enabled = GetDefaultEnabled();
+
+	void RenderThread::SetEnabled(bool enabled) {
+		s_Enabled = enabled;
+	}
+
+	RenderThread& RenderThread::Get() {
+
+		static RenderThread instance;
+		return instance;
+	}
+
+	RenderThread::~RenderThread() {
+		Stop();
+	}
+
+	void RenderThread::Start(GraphicsContext* context, uint32_t framesInFlight) {
+
+		HZ_CORE_ASSERT(!m_Running, "Render thread already running!");
+		HZ_CORE_ASSERT(framesInFlight >= 1 && framesInFlight <= MaxFramesInFlight, "Frames in flight out of range!");
+
+		m_Context = context;
+		m_FramesInFlight = framesInFlight;
+		m_Queues.clear();
+		for (uint32_t i = 0; i < framesInFlight + 1; i++)
+			m_Queues.push_back(std::make_unique<RenderCommandQueue>());
+
+		m_RecordIndex = 0;
+		m_KickedFrames = m_ExecutedFrames = 0;
+		m_ImmediatePending = m_Stopping = false;
+		m_Stats = RenderThreadStats();
+
+		// A context can only be current on one thread at a time.
+		if (m_Context)
+			m_Context->ReleaseCurrent();
+
+		m_Thread = std::thread(&RenderThread::ThreadMain, this);
+		m_ThreadID = m_Thread.get_id();
+		m_Running = true;
+
+		HZ_CORE_INFO("Render thread started, {0} frame(s) in flight", framesInFlight);
+	}
+
+	void RenderThread::Stop() {
+
+		if (!m_Running)
+			return;
+
+		WaitIdle();
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+		m_WorkAvailable.notify_one();
+		m_Thread.join();
+
+		m_ThreadID = std::thread::id();
+		m_Running = false;
+		m_Queues.clear();
+
+		if (m_Context)
+			m_Context->MakeCurrent();
+		m_Context = nullptr;
+	}
+
+	const void* RenderThread::Copy(const void* data, uint32_t size) {
+
+		if (IsRenderThread() || !m_Running)
+			return data;
+
+		void* copy = m_Queues[m_RecordIndex]->AllocateData(size);
+		std::memcpy(copy, data, size);
+		return copy;
+	}
+
+	void RenderThread::Kick() {
+
+		if (!m_Running)
+			return;
+
+		HZ_PROFILE_FUNCTION();
+		Timer timer;
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_KickedFrames++;
+		m_WorkAvailable.notify_one();
+
+		// The queue that's recorded into next must not still be waiting to run.
+		m_WorkDone.wait(lock, [this]() { return m_KickedFrames - m_ExecutedFrames <= m_FramesInFlight; });
+		m_RecordIndex = (uint32_t)(m_KickedFrames % m_Queues.size());
+		m_Stats.WaitMilliseconds = (float)timer.ElapsedMillis();
+	}
+
+	void RenderThread::WaitIdle() {
+
+		if (!m_Running)
+			return;
+
+		HZ_PROFILE_FUNCTION();
+
+		if (!m_Queues[m_RecordIndex]->IsEmpty())
+			Kick();
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_WorkDone.wait(lock, [this]() { return m_ExecutedFrames == m_KickedFrames; });
+	}
+
+	RenderThreadStats RenderThread::GetStats() const {
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Stats;
+	}
+
+	void RenderThread::ExecuteImmediate() {
+
+		HZ_PROFILE_FUNCTION();
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_ImmediatePending = true;
+		m_WorkAvailable.notify_one();
+		m_WorkDone.wait(lock, [this]() { return !m_ImmediatePending; });
+	}
+
+	void RenderThread::ThreadMain() {
+
+		AllocationTracker::SetThreadTag(AllocationTag::Renderer);
+		if (m_Context)
+			m_Context->MakeCurrent();
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		while (true) {
+
+			m_WorkAvailable.wait(lock, [this]() { return m_ImmediatePending || m_ExecutedFrames < m_KickedFrames || m_Stopping; });
+
+			// Immediate commands go first, but always between two frames, never in the middle of one.
+			if (m_ImmediatePending) {
+
+				lock.unlock();
+				m_ImmediateQueue.Execute();
+				lock.lock();
+
+				m_ImmediatePending = false;
+				m_WorkDone.notify_all();
+			}
+			else if (m_ExecutedFrames < m_KickedFrames) {
+
+				RenderCommandQueue& queue = *m_Queues[m_ExecutedFrames % m_Queues.size()];
+				uint32_t commands = queue.GetCommandCount();
+				uint32_t bytes = queue.GetSize();
+
+				lock.unlock();
+				Timer timer;
+				{
+					HZ_PROFILE_SCOPE("RenderThread - Frame");
+					queue.Execute();
+				}
+				float milliseconds = (float)timer.ElapsedMillis();
+				lock.lock();
+
+				m_ExecutedFrames++;
+				m_Stats.Frames = m_ExecutedFrames;
+				m_Stats.Commands = commands;
+				m_Stats.Bytes = bytes;
+				m_Stats.ExecuteMilliseconds = milliseconds;
+				m_WorkDone.notify_all();
+			}
+			else {
+				break; // stopping, and nothing left to run
+			}
+		}
+		lock.unlock();
+
+		if (m_Context)
+			m_Context->ReleaseCurrent();
+	}
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Hazel/Core.h"
+#include "Hazel/Renderer/GraphicsContext.h"
+#include "Hazel/Renderer/RenderCommandQueue.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+
+namespace Hazel {
+
+	struct RenderThreadStats {
+
+		uint64_t Frames = 0;				// executed since Start()
+		uint32_t Commands = 0;				// in the last executed frame
+		uint32_t Bytes = 0;					// of commands and data in the last executed frame
+		float ExecuteMilliseconds = 0.0f;	// render thread, running the last frame (SwapBuffers included)
+		float WaitMilliseconds = 0.0f;		// main thread, blocked in the last Kick() until a frame was free to record into
+	};
+
+
+	class RenderThread {
+	// Runs the graphics API on a thread of its own, which owns the context, so the main thread can record frame N + 1 while frame N is
+	// executed. Everything that touches the API goes through Submit(), which records a command into the current frame, and Kick() hands
+	// the frame over at the end of it. Frames are recorded into a ring of framesInFlight + 1 queues, Kick() blocks when the main thread
+	// is framesInFlight frames ahead. (1 is classic double buffering)
+	// Creating resources goes through SubmitAndWait() instead, so their API handles exist as soon as the constructor returns, and can be
+	// captured by value in every later command. Commands never capture the objects themselves: by the time a command runs, the object
+	// that recorded it may be gone. (its destructor only records the command that deletes the API handles)
+	// When not running, (the default, see SetEnabled()) or when called from the render thread itself, Submit() runs the command
+	// straight away, so the same code works single-threaded. Recording is for the main thread only.
+	public:
+
+		static constexpr uint32_t MaxFramesInFlight = 3;
+
+		RenderThread() = default;
+		~RenderThread();
+
+		RenderThread(const RenderThread&) = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+
+		// The context is released by the calling thread and made current on the render thread. nullptr for commands that don't need one.
+		void Start(GraphicsContext* context, uint32_t framesInFlight = 1);
+		// Runs everything recorded so far, then hands the context back to the calling thread.
+		void Stop();
+
+		inline bool IsRunning() const { return m_Running; }
+		inline bool IsRenderThread() const { return std::this_thread::get_id() == m_ThreadID; }
+
+		template<typename F>
+		void Submit(F&& command) {
+
+			if (IsRenderThread() || !m_Running) {
+				command();
+				return;
+			}
+			m_Queues[m_RecordIndex]->Submit(std::forward<F>(command));
+		}
+
+		// Runs the command on the render thread between two frames, and waits for it. For creating resources and reading state back,
+		// can block for up to a frame. Capturing by reference is fine here.
+		template<typename F>
+		void SubmitAndWait(F&& command) {
+
+			if (IsRenderThread() || !m_Running) {
+				command();
+				return;
+			}
+			m_ImmediateQueue.Submit(std::forward<F>(command));
+			ExecuteImmediate();
+		}
+
+		// data itself when commands run straight away, else a copy that lives as long as the frame's commands. For commands that read
+		// data the caller doesn't keep around. (vertices, uniform arrays, texture uploads)
+		const void* Copy(const void* data, uint32_t size);
+
+		// Ends the frame being recorded and hands it to the render thread. Waits if too many frames are in flight already.
+		void Kick();
+		// Sync point: hands over whatever has been recorded and waits until the render thread has run all of it. (eg. on resize)
+		void WaitIdle();
+
+		RenderThreadStats GetStats() const;
+		inline uint32_t GetFramesInFlight() const { return m_FramesInFlight; }
+
+		// The engine's render thread, started by the Application if IsEnabled().
+		static RenderThread& Get();
+
+		// Has to be called before the Application is created, like RendererAPI::SetAPI(). HZ_RENDER_THREAD=1 in the environment does the
+		// same. Off by default.
+		static void SetEnabled(bool enabled);
+		inline static bool IsEnabled() { return s_Enabled; }
+
+	private:
+
+		void ThreadMain();
+		void ExecuteImmediate();
+
+	private:
+
+		GraphicsContext* m_Context = nullptr;
+		std::thread m_Thread;
+		std::thread::id m_ThreadID;
+		bool m_Running = false;
+
+		std::vector<std::unique_ptr<RenderCommandQueue>> m_Queues;
+		uint32_t m_FramesInFlight = 1;
+		uint32_t m_RecordIndex = 0;		// main thread only
+		RenderCommandQueue m_ImmediateQueue;
+
+		// Guarded by m_Mutex. Frame i is recorded into m_Queues[i % m_Queues.size()].
+		mutable std::mutex m_Mutex;
+		std::condition_variable m_WorkAvailable;	// render thread waits on it
+		std::condition_variable m_WorkDone;		// main thread waits on it
+		uint64_t m_KickedFrames = 0;
+		uint64_t m_ExecutedFrames = 0;
+		bool m_ImmediatePending = false;
+		bool m_Stopping = false;
+		RenderThreadStats m_Stats;
+
+		static bool s_Enabled;
+	};
+}
@@ -0,0 +1,82 @@
+#include "hzpch.h"
+#include "Renderer.h"
+
+#include "Hazel/Renderer/Renderer2D.h"
+
+
+namespace Hazel {
+
+	struct SceneData {
+
+		glm::mat4 ViewProjection = glm::mat4(1.0f);
+	};
+
+	static SceneData s_SceneData;
+	static RenderQueue s_RenderQueue;
+	static ShaderLibrary s_ShaderLibrary;
+
+	void Renderer::Init() {
+
+		HZ_PROFILE_FUNCTION();
+
+		RenderCommand::Init();
+		Renderer2D::Init();
+	}
+
+	void Renderer::Shutdown() {
+
+		HZ_PROFILE_FUNCTION();
+
+		s_RenderQueue.Clear();
+		s_ShaderLibrary = ShaderLibrary();
+		Renderer2D::Shutdown();
+		RenderCommand::Shutdown();
+	}
+
+	void Renderer::BeginScene(const glm::mat4& viewProjection) {
+		s_SceneData.ViewProjection = viewProjection;
+	}
+
+	void Renderer::EndScene() {
+
+		HZ_PROFILE_FUNCTION();
+
+		s_RenderQueue.Sort();
+		s_RenderQueue.Execute(s_SceneData.ViewProjection, RenderCommand::GetRendererAPI());
+		s_RenderQueue.Clear();
+	}
+
+	void Renderer::Submit(const DrawPacket& packet) {
+		s_RenderQueue.Submit(packet);
+	}
+
+	void Renderer::Submit(const std::shared_ptr<Shader>& shader, const std::shared_ptr<VertexArray>& vertexArray, const glm::mat4& transform) {
+
+		DrawPacket packet;
+		packet.Program = shader;
+		packet.Mesh = vertexArray;
+		packet.Transform = transform;
+		s_RenderQueue.Submit(packet);
+	}
+
+	void Renderer::SubmitInstanced(const std::shared_ptr<Shader>& shader, const std::shared_ptr<VertexArray>& vertexArray, 
+		uint32_t instanceCount) {
+
+		if (instanceCount == 0)
+			return;
+
+		DrawPacket packet;
+		packet.Program = shader;
+		packet.Mesh = vertexArray;
+		packet.InstanceCount = instanceCount;
+		s_RenderQueue.Submit(packet);
+	}
+
+	const RenderQueueStats& Renderer::GetQueueStats() {
+		return s_RenderQueue.GetStats();
+	}
+
+	ShaderLibrary& Renderer::GetShaderLibrary() {
+		return s_ShaderLibrary;
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/RenderQueue.h"
+
+#include <glm/glm.hpp>
+
+
+namespace Hazel {
+
+	class Renderer {
+	// Scene level entry point for meshes, on top of RenderCommand. (the Renderer2D has its own BeginScene()/EndScene(), for 2D)
+	// Submitted draws go into a RenderQueue, and are only drawn at EndScene(), sorted to bind as little as possible.
+	public:
+
+		// The RendererAPI, then the Renderer2D. The graphics context has to exist by then.
+		static void Init();
+		static void Shutdown();
+
+		static void BeginScene(const glm::mat4& viewProjection);
+		// Sorts and draws everything submitted since BeginScene().
+		static void EndScene();
+
+		static void Submit(const DrawPacket& packet);
+
+		// One draw of the vertex array, with u_ViewProjection and u_Transform set on the shader.
+		static void Submit(const std::shared_ptr<Shader>& shader, const std::shared_ptr<VertexArray>& vertexArray, 
+			const glm::mat4& transform = glm::mat4(1.0f));
+
+		// instanceCount copies of the vertex array, in one draw. Transforms (colours, etc.) of each instance come from the vertex array's 
+		// per-instance buffers (see BufferLayout), u_Transform is left as the identity.
+		static void SubmitInstanced(const std::shared_ptr<Shader>& shader, const std::shared_ptr<VertexArray>& vertexArray, 
+			uint32_t instanceCount);
+
+		// Of the last EndScene()
+		static const RenderQueueStats& GetQueueStats();
+
+		// Shaders shared by the whole application, hot reloaded by the Application. Emptied at Shutdown(), while there's still a context.
+		static ShaderLibrary& GetShaderLibrary();
+
+		inline static RendererAPI::API GetAPI() { return RendererAPI::GetAPI(); }
+	};
+}
@@ -0,0 +1,622 @@
+#include "hzpch.h"
+#include "Renderer2D.h"
+
+#include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/VertexArray.h"
+#include "Hazel/Renderer/Shader.h"
+
+#include <cmath>
+
+
+namespace Hazel {
+
+	struct QuadVertex {
+
+		glm::vec3 Position;
+		glm::vec4 Color;
+		glm::vec2 TexCoord;
+		int TexIndex;
+		float TilingFactor;
+	};
+
+	struct CircleVertex {
+
+		glm::vec3 WorldPosition;
+		glm::vec3 LocalPosition; // -1 to 1 across the circle
+		glm::vec4 Color;
+		float Thickness;
+		float Fade;
+	};
+
+	struct LineVertex {
+
+		glm::vec3 Position;
+		glm::vec4 Color;
+	};
+
+	struct Renderer2DData {
+
+		static constexpr uint32_t MaxQuads = 10000; // per batch (circles too)
+		static constexpr uint32_t MaxVertices = MaxQuads * 4;
+		static constexpr uint32_t MaxIndices = MaxQuads * 6;
+		static constexpr uint32_t MaxLines = MaxQuads * 2;
+		static constexpr uint32_t MaxTextureSlots = 32;
+		// Batches the streaming vertex buffers can hold before a new one has to wait on the GPU. (~ batches in flight)
+		static constexpr uint32_t StreamingSegments = 6;
+
+		uint32_t TextureSlotCount = 0; // what the RendererAPI supports, up to MaxTextureSlots
+
+		std::shared_ptr<VertexArray> QuadVertexArray;
+		std::shared_ptr<StreamingVertexBuffer> QuadVertexBuffer;
+		std::unique_ptr<Shader> QuadShader;
+		std::shared_ptr<Texture2D> WhiteTexture;
+
+		std::shared_ptr<VertexArray> CircleVertexArray;
+		std::shared_ptr<StreamingVertexBuffer> CircleVertexBuffer;
+		std::unique_ptr<Shader> CircleShader;
+
+		std::shared_ptr<VertexArray> LineVertexArray;
+		std::shared_ptr<StreamingVertexBuffer> LineVertexBuffer;
+		std::unique_ptr<Shader> LineShader;
+		float LineWidth = 1.0f;
+
+		// The batches being accumulated on the CPU, copied into the streaming vertex buffers on flush.
+		uint32_t QuadIndexCount = 0;
+		QuadVertex* QuadVertexBufferBase = nullptr;
+		QuadVertex* QuadVertexBufferPtr = nullptr;
+
+		uint32_t CircleIndexCount = 0;
+		CircleVertex* CircleVertexBufferBase = nullptr;
+		CircleVertex* CircleVertexBufferPtr = nullptr;
+
+		uint32_t LineVertexCount = 0;
+		LineVertex* LineVertexBufferBase = nullptr;
+		LineVertex* LineVertexBufferPtr = nullptr;
+
+		std::shared_ptr<Texture2D> TextureSlots[MaxTextureSlots];
+		uint32_t TextureSlotIndex = 1; // 0 is the white texture
+
+		glm::vec4 QuadVertexPositions[4];
+		glm::mat4 ViewProjection = glm::mat4(1.0f);
+
+		Renderer2D::Statistics Stats;
+	};
+
+	static Renderer2DData s_Data;
+
+
+	// Shaders ---------------------------------------------------------------------------------------------------------------------------
+
+	static const char* s_QuadVertexSrc = R"(
+		#version 330 core
+
+		layout(location = 0) in vec3 a_Position;
+		layout(location = 1) in vec4 a_Color;
+		layout(location = 2) in vec2 a_TexCoord;
+		layout(location = 3) in int a_TexIndex;
+		layout(location = 4) in float a_TilingFactor;
+
+		uniform mat4 u_ViewProjection;
+
+		out vec4 v_Color;
+		out vec2 v_TexCoord;
+		flat out int v_TexIndex;
+
+		void main() {
+
+			v_Color = a_Color;
+			v_TexCoord = a_TexCoord * a_TilingFactor;
+			v_TexIndex = a_TexIndex;
+			gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+		}
+	)";
+
+	// Sampler arrays can only be indexed with constants (in GLSL 3.30), so the texture is picked through a switch, with a case per slot.
+	static std::string BuildQuadFragmentSource(uint32_t textureSlots) {
+
+		std::stringstream ss;
+		ss << R"(
+		#version 330 core
+
+		layout(location = 0) out vec4 color;
+
+		in vec4 v_Color;
+		in vec2 v_TexCoord;
+		flat in int v_TexIndex;
+
+		uniform sampler2D u_Textures[)" << textureSlots << R"(];
+
+		void main() {
+
+			vec4 texColor = v_Color;
+			switch (v_TexIndex) {
+)";
+		for (uint32_t i = 0; i < textureSlots; i++)
+			ss << "\t\t\t\tcase " << i << ": texColor *= texture(u_Textures[" << i << "], v_TexCoord); break;\n";
+		ss << R"(
+			}
+			color = texColor;
+		}
+	)";
+		return ss.str();
+	}
+
+	static const char* s_CircleVertexSrc = R"(
+		#version 330 core
+
+		layout(location = 0) in vec3 a_WorldPosition;
+		layout(location = 1) in vec3 a_LocalPosition;
+		layout(location = 2) in vec4 a_Color;
+		layout(location = 3) in float a_Thickness;
+		layout(location = 4) in float a_Fade;
+
+		uniform mat4 u_ViewProjection;
+
+		out vec3 v_LocalPosition;
+		out vec4 v_Color;
+		out float v_Thickness;
+		out float v_Fade;
+
+		void main() {
+
+			v_LocalPosition = a_LocalPosition;
+			v_Color = a_Color;
+			v_Thickness = a_Thickness;
+			v_Fade = a_Fade;
+			gl_Position = u_ViewProjection * vec4(a_WorldPosition, 1.0);
+		}
+	)";
+
+	static const char* s_CircleFragmentSrc = R"(
+		#version 330 core
+
+		layout(location = 0) out vec4 color;
+
+		in vec3 v_LocalPosition;
+		in vec4 v_Color;
+		in float v_Thickness;
+		in float v_Fade;
+
+		void main() {
+
+			float distance = 1.0 - length(v_LocalPosition);
+			float circle = smoothstep(0.0, v_Fade, distance);
+			circle *= smoothstep(v_Thickness + v_Fade, v_Thickness, distance);
+
+			if (circle == 0.0)
+				discard;
+
+			color = v_Color;
+			color.a *= circle;
+		}
+	)";
+
+	static const char* s_LineVertexSrc = R"(
+		#version 330 core
+
+		layout(location = 0) in vec3 a_Position;
+		layout(location = 1) in vec4 a_Color;
+
+		uniform mat4 u_ViewProjection;
+
+		out vec4 v_Color;
+
+		void main() {
+
+			v_Color = a_Color;
+			gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+		}
+	)";
+
+	static const char* s_LineFragmentSrc = R"(
+		#version 330 core
+
+		layout(location = 0) out vec4 color;
+
+		in vec4 v_Color;
+
+		void main() {
+			color = v_Color;
+		}
+	)";
+
+
+	// Init / Shutdown -------------------------------------------------------------------------------------------------------------------
+
+	void Renderer2D::Init() {
+
+		HZ_PROFILE_FUNCTION();
+
+		s_Data.TextureSlotCount = std::min(RenderCommand::GetMaxTextureSlots(), Renderer2DData::MaxTextureSlots);
+
+		// Every quad (and circle) is 2 triangles over 4 vertices, so the index buffer is the same for all batches, and is only made once.
+		uint32_t* quadIndices = new uint32_t[Renderer2DData::MaxIndices];
+		uint32_t offset = 0;
+		for (uint32_t i = 0; i < Renderer2DData::MaxIndices; i += 6) {
+
+			quadIndices[i + 0] = offset + 0;
+			quadIndices[i + 1] = offset + 1;
+			quadIndices[i + 2] = offset + 2;
+
+			quadIndices[i + 3] = offset + 2;
+			quadIndices[i + 4] = offset + 3;
+			quadIndices[i + 5] = offset + 0;
+
+			offset += 4;
+		}
+		std::shared_ptr<IndexBuffer> quadIndexBuffer(IndexBuffer::Create(quadIndices, Renderer2DData::MaxIndices));
+		delete[] quadIndices;
+
+		// Quads
+		s_Data.QuadVertexArray.reset(VertexArray::Create());
+
+		s_Data.QuadVertexBuffer.reset(StreamingVertexBuffer::Create(Renderer2DData::MaxVertices * sizeof(QuadVertex), 
+			Renderer2DData::StreamingSegments));
+		s_Data.QuadVertexBuffer->SetLayout({
+			{ ShaderDataType::Float3, "a_Position"     },
+			{ ShaderDataType::Float4, "a_Color"        },
+			{ ShaderDataType::Float2, "a_TexCoord"     },
+			{ ShaderDataType::Int,    "a_TexIndex"     },
+			{ ShaderDataType::Float,  "a_TilingFactor" }
+		});
+		s_Data.QuadVertexArray->AddVertexBuffer(s_Data.QuadVertexBuffer);
+		s_Data.QuadVertexArray->SetIndexBuffer(quadIndexBuffer);
+		s_Data.QuadVertexBufferBase = new QuadVertex[Renderer2DData::MaxVertices];
+
+		// Circles
+		s_Data.CircleVertexArray.reset(VertexArray::Create());
+
+		s_Data.CircleVertexBuffer.reset(StreamingVertexBuffer::Create(Renderer2DData::MaxVertices * sizeof(CircleVertex), 
+			Renderer2DData::StreamingSegments));
+		s_Data.CircleVertexBuffer->SetLayout({
+			{ ShaderDataType::Float3, "a_WorldPosition" },
+			{ ShaderDataType::Float3, "a_LocalPosition" },
+			{ ShaderDataType::Float4, "a_Color"         },
+			{ ShaderDataType::Float,  "a_Thickness"     },
+			{ ShaderDataType::Float,  "a_Fade"          }
+		});
+		s_Data.CircleVertexArray->AddVertexBuffer(s_Data.CircleVertexBuffer);
+		s_Data.CircleVertexArray->SetIndexBuffer(quadIndexBuffer);
+		s_Data.CircleVertexBufferBase = new CircleVertex[Renderer2DData::MaxVertices];
+
+		// Lines
+		s_Data.LineVertexArray.reset(VertexArray::Create());
+
+		s_Data.LineVertexBuffer.reset(StreamingVertexBuffer::Create(Renderer2DData::MaxLines * 2 * sizeof(LineVertex), 
+			Renderer2DData::StreamingSegments));
+		s_Data.LineVertexBuffer->SetLayout({
+			{ ShaderDataType::Float3, "a_Position" },
+			{ ShaderDataType::Float4, "a_Color"    }
+		});
+		s_Data.LineVertexArray->AddVertexBuffer(s_Data.LineVertexBuffer);
+		s_Data.LineVertexBufferBase = new LineVertex[Renderer2DData::MaxLines * 2];
+
+		// Slot 0 is a 1x1 white texture, so that plain colored quads go in the same batch (and through the same shader) as textured ones.
+		s_Data.WhiteTexture.reset(Texture2D::Create(1, 1));
+		uint32_t whiteTextureData = 0xffffffff;
+		s_Data.WhiteTexture->SetData(&whiteTextureData, sizeof(uint32_t));
+		s_Data.TextureSlots[0] = s_Data.WhiteTexture;
+
+		int samplers[Renderer2DData::MaxTextureSlots];
+		for (uint32_t i = 0; i < Renderer2DData::MaxTextureSlots; i++)
+			samplers[i] = i;
+
+		s_Data.QuadShader.reset(Shader::Create(s_QuadVertexSrc, BuildQuadFragmentSource(s_Data.TextureSlotCount)));
+		s_Data.QuadShader->Bind();
+		s_Data.QuadShader->SetIntArray("u_Textures", samplers, s_Data.TextureSlotCount);
+
+		s_Data.CircleShader.reset(Shader::Create(s_CircleVertexSrc, s_CircleFragmentSrc));
+		s_Data.LineShader.reset(Shader::Create(s_LineVertexSrc, s_LineFragmentSrc));
+
+		s_Data.QuadVertexPositions[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
+		s_Data.QuadVertexPositions[1] = {  0.5f, -0.5f, 0.0f, 1.0f };
+		s_Data.QuadVertexPositions[2] = {  0.5f,  0.5f, 0.0f, 1.0f };
+		s_Data.QuadVertexPositions[3] = { -0.5f,  0.5f, 0.0f, 1.0f };
+	}
+
+	void Renderer2D::Shutdown() {
+
+		HZ_PROFILE_FUNCTION();
+
+		delete[] s_Data.QuadVertexBufferBase;
+		delete[] s_Data.CircleVertexBufferBase;
+		delete[] s_Data.LineVertexBufferBase;
+
+		// Everything GPU side has to go now, while the context is still around, rather than with the static s_Data.
+		s_Data = Renderer2DData();
+	}
+
+
+	// Scene -----------------------------------------------------------------------------------------------------------------------------
+
+	void Renderer2D::BeginScene(const glm::mat4& viewProjection) {
+
+		HZ_PROFILE_FUNCTION();
+
+		s_Data.ViewProjection = viewProjection;
+
+		s_Data.QuadIndexCount = 0;
+		s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
+
+		s_Data.CircleIndexCount = 0;
+		s_Data.CircleVertexBufferPtr = s_Data.CircleVertexBufferBase;
+
+		s_Data.LineVertexCount = 0;
+		s_Data.LineVertexBufferPtr = s_Data.LineVertexBufferBase;
+
+		s_Data.TextureSlotIndex = 1;
+	}
+
+	void Renderer2D::EndScene() {
+
+		HZ_PROFILE_FUNCTION();
+
+		Flush();
+
+		// Lets go of the textures, they don't have to outlive anything past this point.
+		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
+			s_Data.TextureSlots[i].reset();
+		s_Data.TextureSlotIndex = 1;
+	}
+
+	void Renderer2D::Flush() {
+
+		FlushQuads();
+		FlushCircles();
+		FlushLines();
+	}
+
+	void Renderer2D::FlushQuads() {
+
+		if (s_Data.QuadIndexCount == 0)
+			return;
+
+		HZ_PROFILE_FUNCTION();
+
+		// Written before anything is bound, since the write can wait on the GPU (when the ring of the buffer is full).
+		uint32_t size = (uint32_t)((uint8_t*)s_Data.QuadVertexBufferPtr - (uint8_t*)s_Data.QuadVertexBufferBase);
+		uint32_t offset = s_Data.QuadVertexBuffer->Write(s_Data.QuadVertexBufferBase, size);
+
+		for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++)
+			s_Data.TextureSlots[i]->Bind(i);
+
+		s_Data.QuadShader->Bind();
+		s_Data.QuadShader->SetMat4("u_ViewProjection", s_Data.ViewProjection);
+		RenderCommand::DrawIndexed(s_Data.QuadVertexArray, s_Data.QuadIndexCount, offset / sizeof(QuadVertex));
+		s_Data.Stats.DrawCalls++;
+
+		s_Data.QuadIndexCount = 0;
+		s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
+	}
+
+	void Renderer2D::FlushCircles() {
+
+		if (s_Data.CircleIndexCount == 0)
+			return;
+
+		HZ_PROFILE_FUNCTION();
+
+		uint32_t size = (uint32_t)((uint8_t*)s_Data.CircleVertexBufferPtr - (uint8_t*)s_Data.CircleVertexBufferBase);
+		uint32_t offset = s_Data.CircleVertexBuffer->Write(s_Data.CircleVertexBufferBase, size);
+
+		s_Data.CircleShader->Bind();
+		s_Data.CircleShader->SetMat4("u_ViewProjection", s_Data.ViewProjection);
+		RenderCommand::DrawIndexed(s_Data.CircleVertexArray, s_Data.CircleIndexCount, offset / sizeof(CircleVertex));
+		s_Data.Stats.DrawCalls++;
+
+		s_Data.CircleIndexCount = 0;
+		s_Data.CircleVertexBufferPtr = s_Data.CircleVertexBufferBase;
+	}
+
+	void Renderer2D::FlushLines() {
+
+		if (s_Data.LineVertexCount == 0)
+			return;
+
+		HZ_PROFILE_FUNCTION();
+
+		uint32_t size = (uint32_t)((uint8_t*)s_Data.LineVertexBufferPtr - (uint8_t*)s_Data.LineVertexBufferBase);
+		uint32_t offset = s_Data.LineVertexBuffer->Write(s_Data.LineVertexBufferBase, size);
+
+		s_Data.LineShader->Bind();
+		s_Data.LineShader->SetMat4("u_ViewProjection", s_Data.ViewProjection);
+		RenderCommand::SetLineWidth(s_Data.LineWidth);
+		RenderCommand::DrawLines(s_Data.LineVertexArray, s_Data.LineVertexCount, offset / sizeof(LineVertex));
+		s_Data.Stats.DrawCalls++;
+
+		s_Data.LineVertexCount = 0;
+		s_Data.LineVertexBufferPtr = s_Data.LineVertexBufferBase;
+	}
+
+
+	// Primitives ------------------------------------------------------------------------------------------------------------------------
+
+	// Slot of the texture in the current quad batch, adding it if it isn't in there yet. When all the slots are taken, the batch is 
+	// flushed first.
+	int Renderer2D::GetTextureIndex(const std::shared_ptr<Texture2D>& texture) {
+
+		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++) {
+			if (*s_Data.TextureSlots[i] == *texture)
+				return (int)i;
+		}
+
+		if (s_Data.TextureSlotIndex >= s_Data.TextureSlotCount) {
+
+			FlushQuads();
+			s_Data.Stats.Flushes++;
+
+			for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
+				s_Data.TextureSlots[i].reset();
+			s_Data.TextureSlotIndex = 1;
+		}
+
+		s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
+		return (int)s_Data.TextureSlotIndex++;
+	}
+
+	static inline void EnsureQuadSpace() {
+
+		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices) {
+			Renderer2D::Flush(); // keeps the quads, circles and lines drawn in the same order relative to each other
+			s_Data.Stats.Flushes++;
+		}
+	}
+
+	static inline void WriteQuadVertex(const glm::vec3& position, const glm::vec4& color, float u, float v, int textureIndex, 
+		float tilingFactor) {
+
+		QuadVertex* vertex = s_Data.QuadVertexBufferPtr++;
+		vertex->Position = position;
+		vertex->Color = color;
+		vertex->TexCoord = { u, v };
+		vertex->TexIndex = textureIndex;
+		vertex->TilingFactor = tilingFactor;
+	}
+
+	// Axis aligned, so the corners are worked out directly, instead of through a transform. (most 2D quads are, and it's a lot cheaper)
+	static inline void SubmitAxisAlignedQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color, int textureIndex,
+		float tilingFactor) {
+
+		float x0 = position.x - size.x * 0.5f, x1 = position.x + size.x * 0.5f;
+		float y0 = position.y - size.y * 0.5f, y1 = position.y + size.y * 0.5f;
+
+		WriteQuadVertex({ x0, y0, position.z }, color, 0.0f, 0.0f, textureIndex, tilingFactor);
+		WriteQuadVertex({ x1, y0, position.z }, color, 1.0f, 0.0f, textureIndex, tilingFactor);
+		WriteQuadVertex({ x1, y1, position.z }, color, 1.0f, 1.0f, textureIndex, tilingFactor);
+		WriteQuadVertex({ x0, y1, position.z }, color, 0.0f, 1.0f, textureIndex, tilingFactor);
+
+		s_Data.QuadIndexCount += 6;
+		s_Data.Stats.QuadCount++;
+	}
+
+	static inline void SubmitTransformedQuad(const glm::mat4& transform, const glm::vec4& color, int textureIndex, float tilingFactor) {
+
+		static constexpr float texCoords[4][2] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+		for (int i = 0; i < 4; i++) {
+			glm::vec4 position = transform * s_Data.QuadVertexPositions[i];
+			WriteQuadVertex({ position.x, position.y, position.z }, color, texCoords[i][0], texCoords[i][1], textureIndex, tilingFactor);
+		}
+
+		s_Data.QuadIndexCount += 6;
+		s_Data.Stats.QuadCount++;
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color) {
+		DrawQuad({ position.x, position.y, 0.0f }, size, color);
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color) {
+
+		EnsureQuadSpace();
+		SubmitAxisAlignedQuad(position, size, color, 0, 1.0f);
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const std::shared_ptr<Texture2D>& texture, 
+		float tilingFactor, const glm::vec4& tintColor) {
+
+		DrawQuad({ position.x, position.y, 0.0f }, size, texture, tilingFactor, tintColor);
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const std::shared_ptr<Texture2D>& texture, 
+		float tilingFactor, const glm::vec4& tintColor) {
+
+		EnsureQuadSpace();
+		int textureIndex = GetTextureIndex(texture); // after making space, since a flush here would take the texture's slot with it
+		SubmitAxisAlignedQuad(position, size, tintColor, textureIndex, tilingFactor);
+	}
+
+	void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
+
+		EnsureQuadSpace();
+
+		float c = std::cos(rotation), s = std::sin(rotation);
+		float hx = size.x * 0.5f, hy = size.y * 0.5f;
+
+		static constexpr float corners[4][2] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+		for (int i = 0; i < 4; i++) {
+
+			float x = corners[i][0] * hx, y = corners[i][1] * hy;
+			WriteQuadVertex({ position.x + x * c - y * s, position.y + x * s + y * c, position.z }, color, 
+				(corners[i][0] + 1.0f) * 0.5f, (corners[i][1] + 1.0f) * 0.5f, 0, 1.0f);
+		}
+
+		s_Data.QuadIndexCount += 6;
+		s_Data.Stats.QuadCount++;
+	}
+
+	void Renderer2D::DrawQuad(const glm::mat4& transform, const glm::vec4& color) {
+
+		EnsureQuadSpace();
+		SubmitTransformedQuad(transform, color, 0, 1.0f);
+	}
+
+	void Renderer2D::DrawQuad(const glm::mat4& transform, const std::shared_ptr<Texture2D>& texture, float tilingFactor, 
+		const glm::vec4& tintColor) {
+
+		EnsureQuadSpace();
+		int textureIndex = GetTextureIndex(texture);
+		SubmitTransformedQuad(transform, tintColor, textureIndex, tilingFactor);
+	}
+
+	void Renderer2D::DrawCircle(const glm::vec3& position, float radius, const glm::vec4& color, float thickness, float fade) {
+
+		if (s_Data.CircleIndexCount >= Renderer2DData::MaxIndices) {
+			Flush();
+			s_Data.Stats.Flushes++;
+		}
+
+		static constexpr float corners[4][2] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+		for (int i = 0; i < 4; i++) {
+
+			CircleVertex* vertex = s_Data.CircleVertexBufferPtr++;
+			vertex->WorldPosition = { position.x + corners[i][0] * radius, position.y + corners[i][1] * radius, position.z };
+			vertex->LocalPosition = { corners[i][0], corners[i][1], 0.0f };
+			vertex->Color = color;
+			vertex->Thickness = thickness;
+			vertex->Fade = fade;
+		}
+
+		s_Data.CircleIndexCount += 6;
+		s_Data.Stats.CircleCount++;
+	}
+
+	void Renderer2D::DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color) {
+
+		if (s_Data.LineVertexCount >= Renderer2DData::MaxLines * 2) {
+			Flush();
+			s_Data.Stats.Flushes++;
+		}
+
+		s_Data.LineVertexBufferPtr->Position = p0;
+		s_Data.LineVertexBufferPtr->Color = color;
+		s_Data.LineVertexBufferPtr++;
+
+		s_Data.LineVertexBufferPtr->Position = p1;
+		s_Data.LineVertexBufferPtr->Color = color;
+		s_Data.LineVertexBufferPtr++;
+
+		s_Data.LineVertexCount += 2;
+		s_Data.Stats.LineCount++;
+	}
+
+	void Renderer2D::SetLineWidth(float width) {
+
+		// The width is set once per line batch, so lines of different widths can't share one.
+		if (width != s_Data.LineWidth) {
+			FlushLines();
+			s_Data.LineWidth = width;
+		}
+	}
+
+
+	// Stats -----------------------------------------------------------------------------------------------------------------------------
+
+	const Renderer2D::Statistics& Renderer2D::GetStats() {
+		return s_Data.Stats;
+	}
+
+	void Renderer2D::ResetStats() {
+		s_Data.Stats = Statistics();
+	}
+}
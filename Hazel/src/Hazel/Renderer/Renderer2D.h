@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Hazel/Renderer/Texture.h"
+
+#include <glm/glm.hpp>
+
+#include <memory>
+
+
+namespace Hazel {
+
+	class Renderer2D {
+	// Batch renderer for 2D. Quads, circles and lines are accumulated on the CPU and drawn with one draw call per batch (per primitive 
+	// type), instead of one per shape. A quad batch ends when it's full, or when it needs more textures than can be bound at once.
+	// Only what's drawn between BeginScene() and EndScene() is batched together, and textures have to outlive the EndScene().
+	public:
+
+		static void Init();
+		static void Shutdown();
+
+		static void BeginScene(const glm::mat4& viewProjection);
+		static void EndScene();
+		// Draws everything batched so far.
+		static void Flush();
+
+		// Quads, position is the centre of the quad.
+		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
+		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
+		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const std::shared_ptr<Texture2D>& texture, 
+			float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const std::shared_ptr<Texture2D>& texture, 
+			float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+
+		// rotation is in radians
+		static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color);
+
+		// The unit quad (-0.5 to 0.5) transformed by transform.
+		static void DrawQuad(const glm::mat4& transform, const glm::vec4& color);
+		static void DrawQuad(const glm::mat4& transform, const std::shared_ptr<Texture2D>& texture, float tilingFactor = 1.0f, 
+			const glm::vec4& tintColor = glm::vec4(1.0f));
+
+		// thickness goes from 0 (nothing) to 1 (filled), fade is how blurry the edges are.
+		static void DrawCircle(const glm::vec3& position, float radius, const glm::vec4& color, float thickness = 1.0f, float fade = 0.005f);
+
+		static void DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color);
+		static void SetLineWidth(float width);
+
+
+		struct Statistics {
+
+			uint32_t DrawCalls = 0;
+			uint32_t QuadCount = 0;
+			uint32_t CircleCount = 0;
+			uint32_t LineCount = 0;
+			uint32_t Flushes = 0; // batches that had to be drawn before EndScene(), because they were full or ran out of texture slots
+
+			uint32_t GetTotalVertexCount() const { return (QuadCount + CircleCount) * 4 + LineCount * 2; }
+		};
+
+		// Totals since the last ResetStats().
+		static const Statistics& GetStats();
+		static void ResetStats();
+
+	private:
+
+		static void FlushQuads();
+		static void FlushCircles();
+		static void FlushLines();
+
+		static int GetTextureIndex(const std::shared_ptr<Texture2D>& texture);
+	};
+}
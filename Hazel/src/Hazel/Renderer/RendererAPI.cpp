@@ -0,0 +1,40 @@
+#include "hzpch.h"
+#include "RendererAPI.h"
+
+#include "Platform/OpenGL/OpenGLRendererAPI.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+#include <cstdlib>
+#include <cstring>
+
+
+namespace Hazel {
+
+	static RendererAPI::API GetDefaultAPI() {
+
+		const char* value = std::getenv("HZ_RENDERER_API");
+		if (value && std::strcmp(value, "null") == 0)
+			return RendererAPI::API::Null;
+
+		return RendererAPI::API::OpenGL;
+	}
+
+	RendererAPI::API RendererAPI::s_API = GetDefaultAPI();
+
+	void RendererAPI::SetAPI(API api) {
+		s_API = api;
+	}
+
+	RendererAPI* RendererAPI::Create() {
+
+		switch (s_API) {
+
+			case API::None:		HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case API::OpenGL:	return new OpenGLRendererAPI();
+			case API::Null:		return new NullRendererAPI();
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+}
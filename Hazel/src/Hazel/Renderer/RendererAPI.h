@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Hazel/Renderer/VertexArray.h"
+
+#include <glm/glm.hpp>
+
+#include <memory>
+
+
+namespace Hazel {
+
+	enum class BlendMode : uint8_t {
+		Opaque = 0,	// no blending
+		Alpha,		// src * a + dst * (1 - a), what Init() sets up
+		Additive	// src * a + dst
+	};
+
+	class RendererAPI {
+	// The draw calls and render state of one graphics API. GraphicsContext owns the context itself (creation, swapping), this is what
+	// gets issued into it. Everything above goes through RenderCommand, so nothing outside of Platform/ calls the API directly.
+	public:
+
+		enum class API {
+			None = 0,
+			OpenGL = 1,
+			Null = 2	// records commands instead of issuing them, no GPU (or context) needed. (see NullRendererAPI)
+		};
+
+	public:
+
+		virtual ~RendererAPI() = default;
+
+		virtual void Init() = 0;
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+		virtual void SetClearColor(const glm::vec4& color) = 0;
+		virtual void Clear() = 0;
+		virtual void SetBlendMode(BlendMode mode) = 0;
+
+		// indexCount of 0 draws the whole index buffer. baseVertex is added to every index, to draw from further into the vertex buffer.
+		virtual void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) = 0;
+		// Draws the vertex array instanceCount times over, in one call. Per-instance data comes from its vertex buffers whose layout has
+		// a divisor. (see BufferLayout)
+		virtual void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) = 0;
+		// Pairs of vertices, each one a line.
+		virtual void DrawLines(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) = 0;
+		virtual void SetLineWidth(float width) = 0;
+
+		// How many textures a shader can sample from at once.
+		virtual uint32_t GetMaxTextureSlots() const = 0;
+
+		// GPU timings of the frame's named scopes, (see HZ_PROFILE_GPU_SCOPE) a no-op for an API that can't time anything. name has to
+		// be a string literal, it's kept as a pointer until the frame's timings have been read back.
+		virtual void BeginGPUFrame() = 0;
+		virtual void EndGPUFrame() = 0;
+		virtual void BeginGPUScope(const char* name) = 0;
+		virtual void EndGPUScope() = 0;
+
+		// Logs how the shaders created so far were loaded, (see OpenGLShaderCache) nothing for an API without a shader cache.
+		virtual void LogShaderCacheStats() const = 0;
+
+		inline static API GetAPI() { return s_API; }
+		// Has to be called before anything is created. (eg. in CreateApplication(), before the Application) HZ_RENDERER_API=null in
+		// the environment does the same for the Null API.
+		static void SetAPI(API api);
+
+		static RendererAPI* Create();
+
+	private:
+
+		static API s_API;
+	};
+}
@@ -1,123 +1,203 @@
 #include "hzpch.h"
 #include "Shader.h"
 
-#include <glad/glad.h>
+#include "Hazel/Renderer/RendererAPI.h"
 
-namespace Hazel {
+#include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/Null/NullShader.h"
 
-	Shader::Shader(const std::string& vertexSrc, const std::string& fragmentSrc) {
-		
-		// Creates an empty vertex shader handle
-		GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 
-		// Send the vertex shader source to GL
-		// Note that std::string's .c_str() is NULL character terminated
-		const GLchar* source = vertexSrc.c_str();
-		glShaderSource(vertexShader, 1, &source, 0);
 
-		// Compile the vertex shader
-		glCompileShader(vertexShader);
+namespace Hazel {
 
-		GLint isCompiled = 0;
-		glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &isCompiled);
-		if (isCompiled == GL_FALSE) {
+	static bool ReadFile(const std::string& filepath, std::string& contents) {
 
-			GLint maxLength = 0;
-			glGetShaderiv(vertexShader, GL_INFO_LOG_LENGTH, &maxLength);
+		std::ifstream in(filepath, std::ios::in | std::ios::binary);
+		if (!in) {
+			HZ_CORE_ERROR("Could not open file '{0}'", filepath);
+			return false;
+		}
 
-			// The maxLength includes the NULL character
-			std::vector<GLchar> infoLog(maxLength);
-			glGetShaderInfoLog(vertexShader, maxLength, &maxLength, &infoLog[0]);
+		in.seekg(0, std::ios::end);
+		contents.resize((size_t)in.tellg());
+		in.seekg(0, std::ios::beg);
+		in.read(&contents[0], contents.size());
+		return true;
+	}
 
-			// We don't need the shader anymore. 
-			glDeleteShader(vertexShader);
+	// 0 when the file doesn't exist (anymore), or is being replaced by an editor right now.
+	static int64_t GetLastWriteTime(const std::string& filepath) {
 
-			HZ_CORE_ERROR("{0}", infoLog.data());
-			HZ_CORE_ASSERT(false, "Vertex Shader compilation failure!");
-			return;
+		std::error_code error;
+		auto time = std::filesystem::last_write_time(filepath, error);
+		return error ? 0 : (int64_t)time.time_since_epoch().count();
+	}
+
+	bool Shader::ParseStages(const std::string& source, std::string& vertexSrc, std::string& fragmentSrc) {
+
+		vertexSrc.clear();
+		fragmentSrc.clear();
+
+		const char* typeToken = "#type";
+		size_t typeTokenLength = std::strlen(typeToken);
+		size_t position = source.find(typeToken, 0);
+		while (position != std::string::npos) {
+
+			size_t endOfLine = source.find_first_of("\r\n", position);
+			if (endOfLine == std::string::npos) {
+				HZ_CORE_ERROR("Shader: nothing after '{0}'", source.substr(position));
+				return false;
+			}
+
+			size_t begin = source.find_first_not_of(" \t", position + typeTokenLength);
+			size_t end = source.find_last_not_of(" \t", endOfLine - 1);
+			std::string type = begin <= end ? source.substr(begin, end - begin + 1) : std::string();
+
+			// The stage goes up to the next #type, or the end of the file.
+			size_t stageBegin = source.find_first_not_of("\r\n", endOfLine);
+			position = stageBegin == std::string::npos ? std::string::npos : source.find(typeToken, stageBegin);
+			std::string stage = stageBegin == std::string::npos ? std::string() : source.substr(stageBegin, position - stageBegin);
+
+			std::string* target = nullptr;
+			if (type == "vertex")
+				target = &vertexSrc;
+			else if (type == "fragment" || type == "pixel")
+				target = &fragmentSrc;
+
+			if (!target || !target->empty()) {
+				HZ_CORE_ERROR("Shader: {0} stage type '{1}'", target ? "second" : "unknown", type);
+				return false;
+			}
+			*target = std::move(stage);
 		}
 
-		// Create an empty fragment shader handle
-		GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+		if (vertexSrc.empty() || fragmentSrc.empty()) {
+			HZ_CORE_ERROR("Shader: needs a '#type vertex' and a '#type fragment' stage");
+			return false;
+		}
+
+		return true;
+	}
 
-		// Send the fragment shader source code to GL
-		// Note that std::string's .c_str() is NULL character terminated.
-		source = fragmentSrc.c_str();
-		glShaderSource(fragmentShader, 1, &source, 0);
+	Shader* Shader::Create(const std::string& vertexSrc, const std::string& fragmentSrc) {
+		return Create(std::string(), vertexSrc, fragmentSrc);
+	}
 
-		// Compile the fragment shader
-		glCompileShader(fragmentShader);
+	Shader* Shader::Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc) {
 
-		glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &isCompiled);
-		if (isCompiled == GL_FALSE) {
+		switch (RendererAPI::GetAPI()) {
 
-			GLint maxLength = 0;
-			glGetShaderiv(fragmentShader, GL_INFO_LOG_LENGTH, &maxLength);
+			case RendererAPI::API::None:	HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:	return new OpenGLShader(name, vertexSrc, fragmentSrc);
+			case RendererAPI::API::Null:	return new NullShader(name, vertexSrc, fragmentSrc);
+		}
 
-			// The maxLength includes the NULL character
-			std::vector<GLchar> infoLog(maxLength);
-			glGetShaderInfoLog(fragmentShader, maxLength, &maxLength, &infoLog[0]);
+		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
 
-			// We don't need the shader anymore.
-			glDeleteShader(fragmentShader);
-			// Either of them. Don't leak shaders.
-			glDeleteShader(vertexShader);
+	Shader* Shader::Create(const std::string& filepath) {
 
-			HZ_CORE_ERROR("{0}", infoLog.data());
-			HZ_CORE_ASSERT(false, "Fragment shader compilation failure!");
-			return;
+		std::string source, vertexSrc, fragmentSrc;
+		if (!ReadFile(filepath, source) || !ParseStages(source, vertexSrc, fragmentSrc)) {
+			HZ_CORE_ERROR("Failed to load shader '{0}'", filepath);
+			return nullptr;
 		}
 
-		// Vertex and Fragment shaders are successfully compiled.
-		// Now time to link them together into a program.
-		// Get a program object. 
-		m_RendererID = glCreateProgram();
-		GLuint program = m_RendererID;
+		return Create(std::filesystem::path(filepath).stem().string(), vertexSrc, fragmentSrc);
+	}
+
+	// ShaderLibrary ---------------------------------------------------------------------------------------------------------------------
 
-		// Attach our shaders to our program
-		glAttachShader(program, vertexShader);
-		glAttachShader(program, fragmentShader);
+	void ShaderLibrary::Add(const std::string& name, const std::shared_ptr<Shader>& shader) {
 
-		// Link our program
-		glLinkProgram(program);
+		HZ_CORE_ASSERT(!Exists(name), "Shader already exists!");
+		m_Shaders[name] = shader;
+	}
 
-		// Note the different functions here: glGetProgram* instead of glGetShader*.
-		GLint isLinked = 0;
-		glGetProgramiv(program, GL_LINK_STATUS, (int*)&isLinked);
-		if (isLinked == GL_FALSE) {
+	std::shared_ptr<Shader> ShaderLibrary::Load(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc) {
 
-			GLint maxLength = 0;
-			glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+		std::shared_ptr<Shader> shader(Shader::Create(name, vertexSrc, fragmentSrc));
+		Add(name, shader);
+		return shader;
+	}
 
-			// The maxLength includes the NULL character
-			std::vector<GLchar> infoLog(maxLength);
-			glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
+	std::shared_ptr<Shader> ShaderLibrary::Load(const std::string& filepath) {
+		return Load(std::filesystem::path(filepath).stem().string(), filepath);
+	}
 
-			// We don't need the program anymore.
-			glDeleteProgram(program);
-			// Don't leak shaders either.
-			glDeleteShader(vertexShader);
-			glDeleteShader(fragmentShader);
+	std::shared_ptr<Shader> ShaderLibrary::Load(const std::string& name, const std::string& filepath) {
 
-			HZ_CORE_ERROR("{0}", infoLog.data());
-			HZ_CORE_ASSERT(false, "Shader link failure!");
-			return;
+		// Read before the shader, so that a save in between shows up as a change.
+		int64_t lastWriteTime = GetLastWriteTime(filepath);
+
+		std::string source, vertexSrc, fragmentSrc;
+		if (!ReadFile(filepath, source) || !Shader::ParseStages(source, vertexSrc, fragmentSrc)) {
+			HZ_CORE_ERROR("Failed to load shader '{0}'", filepath);
+			return nullptr;
 		}
 
-		// Always detach shaders after a successful link.
-		glDetachShader(program, vertexShader);
-		glDetachShader(program, fragmentShader);
+		std::shared_ptr<Shader> shader = Load(name, vertexSrc, fragmentSrc);
+		m_WatchedFiles.push_back({ name, filepath, lastWriteTime });
+		return shader;
+	}
+
+	std::shared_ptr<Shader> ShaderLibrary::Get(const std::string& name) const {
+
+		auto it = m_Shaders.find(name);
+		HZ_CORE_ASSERT(it != m_Shaders.end(), "Shader not found!");
+		return it != m_Shaders.end() ? it->second : nullptr;
+	}
+
+	bool ShaderLibrary::Exists(const std::string& name) const {
+		return m_Shaders.find(name) != m_Shaders.end();
 	}
 
-	Shader::~Shader() {
-		glDeleteProgram(m_RendererID);
+	bool ShaderLibrary::IsReady() const {
+		return GetReadyCount() == GetCount();
 	}
 
-	void Shader::Bind() const {
-		glUseProgram(m_RendererID);
+	uint32_t ShaderLibrary::GetReadyCount() const {
+
+		uint32_t ready = 0;
+		for (const auto& [name, shader] : m_Shaders)
+			ready += shader->IsReady() ? 1 : 0;
+		return ready;
 	}
 
-	void Shader::Unbind() const {
-		glUseProgram(0);
+	void ShaderLibrary::WaitUntilReady() const {
+
+		HZ_PROFILE_FUNCTION();
+
+		for (const auto& [name, shader] : m_Shaders)
+			shader->WaitUntilReady();
+	}
+
+	void ShaderLibrary::ReloadChanged() {
+
+		if (!m_HotReload || m_WatchedFiles.empty() || m_WatchTimer.Elapsed() < WatchInterval)
+			return;
+
+		HZ_PROFILE_FUNCTION();
+		m_WatchTimer.Reset();
+
+		for (WatchedFile& file : m_WatchedFiles) {
+
+			int64_t lastWriteTime = GetLastWriteTime(file.Filepath);
+			if (lastWriteTime == 0 || lastWriteTime == file.LastWriteTime)
+				continue;
+			file.LastWriteTime = lastWriteTime;
+
+			// A file that doesn't parse is left for the next save, the shader keeps what it has.
+			std::string source, vertexSrc, fragmentSrc;
+			if (!ReadFile(file.Filepath, source) || !Shader::ParseStages(source, vertexSrc, fragmentSrc))
+				continue;
+
+			HZ_CORE_INFO("Reloading shader '{0}' ({1})", file.Name, file.Filepath);
+			Get(file.Name)->Reload(vertexSrc, fragmentSrc);
+		}
 	}
-}
\ No newline at end of file
+}
@@ -1,6 +1,14 @@
 #pragma once
 
+#include "Hazel/Timer.h"
+#include "Hazel/Memory/PoolAllocator.h"
+
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
 
 
 namespace Hazel {
@@ -9,15 +17,96 @@ namespace Hazel {
 
 	public:
 
-		Shader(const std::string& vertexSrc, const std::string& fragmentSrc);
-		~Shader();
+		HZ_POOL_ALLOCATED()
+
+		virtual ~Shader() = default;
 		
 		// Bind() and Unbind() are for debugging purposes
-		void Bind() const;
-		void Unbind() const;
+		virtual void Bind() const = 0;
+		virtual void Unbind() const = 0;
+
+		// Uniforms, set on this shader's own program, it doesn't have to be bound. (glProgramUniform*(), before OpenGL 4.1 the program is
+		// bound for the call and the previous one bound again) Locations are looked up once, not per call, a name the shader doesn't have
+		// (or that the compiler optimised away) is ignored. Values are kept, and set again on the program a Reload() links.
+		virtual void SetInt(const std::string& name, int value) = 0;
+		virtual void SetIntArray(const std::string& name, const int* values, uint32_t count) = 0;
+		virtual void SetFloat(const std::string& name, float value) = 0;
+		virtual void SetFloat2(const std::string& name, const glm::vec2& value) = 0;
+		virtual void SetFloat3(const std::string& name, const glm::vec3& value) = 0;
+		virtual void SetFloat4(const std::string& name, const glm::vec4& value) = 0;
+		virtual void SetMat4(const std::string& name, const glm::mat4& value) = 0;
+
+		virtual const std::string& GetName() const = 0;
+
+		// Compiling may still be going on after Create() returns. The first Bind() or Set*() waits for it to finish, IsReady() tells
+		// whether that would have to wait, and never waits itself. (a loading screen can keep drawing meanwhile, polling it every frame)
+		virtual bool IsReady() const = 0;
+		virtual void WaitUntilReady() const = 0;
+
+		// Compiles the new sources, (asynchronously, like Create()) and swaps them in once they've linked. If they don't, the errors are
+		// logged and the shader keeps the program it had, so a typo while hot reloading doesn't take everything down with it.
+		virtual void Reload(const std::string& vertexSrc, const std::string& fragmentSrc) = 0;
+
+		// Starts compiling and linking the two stages, with the implementation of the current RendererAPI::GetAPI().
+		static Shader* Create(const std::string& vertexSrc, const std::string& fragmentSrc);
+		static Shader* Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+		// A single .glsl file with every stage in it, each one starting with a "#type vertex" or "#type fragment" (or "pixel") line.
+		// Named after the file. (without the extension) nullptr if the file can't be read, or has no vertex and fragment stage.
+		static Shader* Create(const std::string& filepath);
+
+		// Splits the source of a single file shader into its stages, false if it doesn't have exactly a vertex and a fragment stage.
+		static bool ParseStages(const std::string& source, std::string& vertexSrc, std::string& fragmentSrc);
+	};
+
+
+	class ShaderLibrary {
+	// Shaders by name. Load() every shader up front, during startup or behind a loading screen, so that the driver compiles them all at
+	// the same time (in parallel, where it can) instead of one after the other as they're first needed. IsReady() then tells when all of
+	// them have finished, without ever waiting for one.
+	// Shaders loaded from a file are hot reloaded: ReloadChanged() (once a frame, the Application does it for the Renderer's library)
+	// looks at the files' modification times every WatchInterval seconds, and recompiles the ones that changed.
+	public:
+
+		static constexpr double WatchInterval = 0.5;
+
+		void Add(const std::string& name, const std::shared_ptr<Shader>& shader);
+		// Starts compiling, and returns straight away.
+		std::shared_ptr<Shader> Load(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+		// Single file shaders, (see Shader::Create()) named after the file unless given a name. nullptr if the file can't be loaded.
+		std::shared_ptr<Shader> Load(const std::string& filepath);
+		std::shared_ptr<Shader> Load(const std::string& name, const std::string& filepath);
+
+		std::shared_ptr<Shader> Get(const std::string& name) const;
+		bool Exists(const std::string& name) const;
+
+		bool IsReady() const;
+		uint32_t GetReadyCount() const; // for progress bars, out of GetCount()
+		inline uint32_t GetCount() const { return (uint32_t)m_Shaders.size(); }
+		void WaitUntilReady() const;
+
+		void ReloadChanged();
+		// On by default, except in Dist.
+		inline void SetHotReload(bool enabled) { m_HotReload = enabled; }
+		inline bool IsHotReloadEnabled() const { return m_HotReload; }
+
+	private:
+
+		struct WatchedFile {
+
+			std::string Name;
+			std::string Filepath;
+			int64_t LastWriteTime; // std::filesystem::file_time_type's count, 0 when the file couldn't be found
+		};
 
 	private:
 
-		uint32_t m_RendererID;
+		std::unordered_map<std::string, std::shared_ptr<Shader>> m_Shaders;
+		std::vector<WatchedFile> m_WatchedFiles;
+		Timer m_WatchTimer;
+#ifdef HZ_DIST
+		bool m_HotReload = false;
+#else
+		bool m_HotReload = true;
+#endif
 	};
-}
\ No newline at end of file
+}
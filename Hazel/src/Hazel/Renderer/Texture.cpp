@@ -0,0 +1,24 @@
+#include "hzpch.h"
+#include "Texture.h"
+
+#include "Hazel/Renderer/RendererAPI.h"
+
+#include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/Null/NullTexture.h"
+
+
+namespace Hazel {
+
+	Texture2D* Texture2D::Create(uint32_t width, uint32_t height) {
+
+		switch (RendererAPI::GetAPI()) {
+
+			case RendererAPI::API::None:	HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:	return new OpenGLTexture2D(width, height);
+			case RendererAPI::API::Null:	return new NullTexture2D(width, height);
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Hazel/Core.h"
+#include "Hazel/Memory/PoolAllocator.h"
+
+
+namespace Hazel {
+
+	class Texture {
+
+	public:
+
+		HZ_POOL_ALLOCATED()
+
+		virtual ~Texture() = default;
+
+		virtual uint32_t GetWidth() const = 0;
+		virtual uint32_t GetHeight() const = 0;
+
+		// Replaces the whole texture, data is width * height RGBA8 pixels. (so size has to be width * height * 4)
+		virtual void SetData(const void* data, uint32_t size) = 0;
+
+		virtual void Bind(uint32_t slot = 0) const = 0;
+
+		// Same texture, not just the same contents. (used to find a texture in the Renderer2D's batch)
+		virtual bool operator==(const Texture& other) const = 0;
+	};
+
+	class Texture2D : public Texture {
+
+	public:
+
+		// Empty RGBA8 texture, filled through SetData(). (there's no image loading yet)
+		static Texture2D* Create(uint32_t width, uint32_t height);
+	};
+}
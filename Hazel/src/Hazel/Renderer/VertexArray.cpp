@@ -0,0 +1,24 @@
+#include "hzpch.h"
+#include "VertexArray.h"
+
+#include "Hazel/Renderer/RendererAPI.h"
+
+#include "Platform/OpenGL/OpenGLVertexArray.h"
+#include "Platform/Null/NullVertexArray.h"
+
+
+namespace Hazel {
+
+	VertexArray* VertexArray::Create() {
+
+		switch (RendererAPI::GetAPI()) {
+
+			case RendererAPI::API::None:	HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:	return new OpenGLVertexArray();
+			case RendererAPI::API::Null:	return new NullVertexArray();
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Hazel/Renderer/Buffer.h"
+
+#include <memory>
+
+
+namespace Hazel {
+
+	class VertexArray {
+	// Ties vertex buffers (and their layouts) to an index buffer, so a mesh is bound with one call.
+	public:
+
+		HZ_POOL_ALLOCATED()
+
+		virtual ~VertexArray() = default;
+
+		virtual void Bind() const = 0;
+		virtual void Unbind() const = 0;
+
+		// The buffer's layout has to be set before it's added.
+		virtual void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) = 0;
+		virtual void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) = 0;
+
+		virtual const std::vector<std::shared_ptr<VertexBuffer>>& GetVertexBuffers() const = 0;
+		virtual const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const = 0;
+
+		static VertexArray* Create();
+	};
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <chrono>
+
+
+namespace Hazel {
+
+	class Timer {
+	// High resolution clock (steady, so it never jumps backwards), measuring the time since it was created or last Reset().
+	public:
+
+		Timer() { Reset(); }
+
+		inline void Reset() { m_Start = std::chrono::steady_clock::now(); }
+
+		inline double Elapsed() const { return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count(); }
+		inline double ElapsedMillis() const { return Elapsed() * 1000.0; }
+
+	private:
+
+		std::chrono::steady_clock::time_point m_Start;
+	};
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+
+namespace Hazel {
+
+	class Timestep {
+	// Time between two updates, in seconds. Passed to Layer::OnUpdate() (the frame's delta time) and Layer::OnFixedUpdate() (the fixed step)
+	public:
+
+		Timestep(float time = 0.0f)
+			: m_Time(time)
+		{}
+
+		operator float() const { return m_Time; } // lets a Timestep be used directly in maths, eg. position += speed * ts
+
+		inline float GetSeconds() const { return m_Time; }
+		inline float GetMilliseconds() const { return m_Time * 1000.0f; }
+
+	private:
+
+		float m_Time;
+	};
+}
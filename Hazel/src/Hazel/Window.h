@@ -4,18 +4,22 @@
 
 #include "Hazel/Core.h"
 #include "Hazel/Events/Event.h"
+#include "Hazel/Events/EventQueue.h"
 
 
 namespace Hazel {
 
+	class GraphicsContext;
+
 	struct WindowProps {
 		
 		std::string Title;
 		unsigned int Width;
 		unsigned int Height;
+		bool Headless; // no visible window, just an offscreen OpenGL context. (for CI and servers without a display or GPU)
 
-		WindowProps(const std::string& title = "Hazel Engine", unsigned int width = 1280, unsigned int height = 720)
-			: Title(title), Width(width), Height(height)
+		WindowProps(const std::string& title = "Hazel Engine", unsigned int width = 1280, unsigned int height = 720, bool headless = false)
+			: Title(title), Width(width), Height(height), Headless(headless)
 		{}
 	};
 
@@ -29,17 +33,28 @@ namespace Hazel {
 		using EventCallbackFn = std::function<void(Event&)>; // std::function object, which: returns void, takes in a reference to Event object
 
 		virtual ~Window() {}
-		virtual void OnUpdate() = 0;
+		virtual void OnUpdate() = 0; // PollEvents() followed by SwapBuffers()
+		virtual void PollEvents() = 0;
+		virtual void SwapBuffers() = 0;
+		// Blocks until at least one event arrives (and processes it like PollEvents()), or until timeout seconds pass. 0 waits forever.
+		virtual void WaitEvents(double timeout = 0.0) = 0;
+		// Wakes up a WaitEvents() call, can be called from any thread.
+		virtual void Wake() = 0;
 
 		virtual unsigned int GetWidth() const = 0;
 		virtual unsigned int GetHeight() const = 0;
+		virtual float GetRefreshRate() const = 0; // of the monitor the window is shown on, in Hz
+		virtual bool IsHeadless() const = 0;
 
 		// Window attributes (Accessors && Mutators)
 		virtual void SetEventCallback(const EventCallbackFn& callback) = 0;
+		// When a queue is set, events are buffered in it instead of going through the EventCallback straight away. (nullptr to go back)
+		virtual void SetEventQueue(EventQueue* queue) = 0;
 		virtual void SetVSync(bool enabled) = 0;
 		virtual bool IsVSync() const = 0;
 
 		inline virtual void* GetNativeWindow() const = 0; // returns a GLFWwindow pointer for now.
+		virtual GraphicsContext& GetGraphicsContext() = 0;
 
 		// will be implemented for each specific platforms, in the directory "/platform/~~~"
 		// "props" have a default parameter, automatically initialises with "WindowProps" struct
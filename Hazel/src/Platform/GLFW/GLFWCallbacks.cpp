@@ -0,0 +1,113 @@
+#include "hzpch.h"
+#include "GLFWCallbacks.h"
+
+#include "Hazel/Events/ApplicationEvent.h"
+#include "Hazel/Events/MouseEvent.h"
+#include "Hazel/Events/KeyEvent.h"
+
+#include <GLFW/glfw3.h>
+
+
+namespace Hazel {
+
+	// Copies the event into the Application's EventQueue to be dispatched during the next frame's event stage, or if no queue has been
+	// set, constructs it on the stack and dispatches it right away (the old blocking behaviour).
+	template<typename T, typename... Args>
+	static void PostEvent(GLFWWindowData& data, Args&&... args) {
+
+		if (data.Queue) {
+			data.Queue->Emplace<T>(std::forward<Args>(args)...);
+			return;
+		}
+
+		T event(std::forward<Args>(args)...);
+		data.EventCallback(event);
+	}
+
+	static GLFWWindowData& GetData(GLFWwindow* window) {
+		return *(GLFWWindowData*)glfwGetWindowUserPointer(window);
+	}
+
+	// The callbacks are captureless lambdas, (GLFW only takes plain function pointers) they find the window's GLFWWindowData through its
+	// user pointer instead. GLFW calls them from glfwPollEvents() / glfwWaitEvents(), on the main thread.
+	void SetGLFWCallbacks(GLFWwindow* window, GLFWWindowData& data) {
+
+		glfwSetWindowUserPointer(window, &data);
+
+		double mouseX, mouseY;
+		glfwGetCursorPos(window, &mouseX, &mouseY);
+		data.MouseX = (float)mouseX;
+		data.MouseY = (float)mouseY;
+
+		glfwSetWindowSizeCallback(window, [](GLFWwindow* window, int width, int height) {
+
+			GLFWWindowData& data = GetData(window);
+			data.Width = width;
+			data.Height = height;
+
+			PostEvent<WindowResizeEvent>(data, width, height);
+		});
+
+		glfwSetWindowCloseCallback(window, [](GLFWwindow* window) {
+			PostEvent<WindowCloseEvent>(GetData(window));
+		});
+
+		glfwSetKeyCallback(window, [](GLFWwindow* window, int key, int scancode, int action, int mods) {
+
+			GLFWWindowData& data = GetData(window);
+
+			switch (action) {
+
+				case (GLFW_PRESS): {
+					PostEvent<KeyPressedEvent>(data, key, 0);
+					break;
+				}
+				case (GLFW_RELEASE): {
+					PostEvent<KeyReleasedEvent>(data, key);
+					break;
+				}
+				case (GLFW_REPEAT): {
+					PostEvent<KeyPressedEvent>(data, key, 1);
+					break;
+				}
+			}
+		});
+
+		glfwSetCharCallback(window, [](GLFWwindow* window, unsigned int keycode) {
+			PostEvent<KeyTypedEvent>(GetData(window), (int)keycode);
+		});
+
+		glfwSetMouseButtonCallback(window, [](GLFWwindow* window, int button, int action, int mods) {
+
+			GLFWWindowData& data = GetData(window);
+
+			switch (action) {
+
+				case (GLFW_PRESS): {
+					PostEvent<MouseButtonPressedEvent>(data, button);
+					break;
+				}
+				case (GLFW_RELEASE): {
+					PostEvent<MouseButtonReleasedEvent>(data, button);
+					break;
+				}
+			}
+		});
+
+		glfwSetScrollCallback(window, [](GLFWwindow* window, double xOffset, double yOffset) {
+			PostEvent<MouseScrolledEvent>(GetData(window), (float)xOffset, (float)yOffset);
+		});
+
+		glfwSetCursorPosCallback(window, [](GLFWwindow* window, double xPos, double yPos) {
+
+			GLFWWindowData& data = GetData(window);
+
+			float deltaX = (float)xPos - data.MouseX;
+			float deltaY = (float)yPos - data.MouseY;
+			data.MouseX = (float)xPos;
+			data.MouseY = (float)yPos;
+
+			PostEvent<MouseMovedEvent>(data, (float)xPos, (float)yPos, deltaX, deltaY);
+		});
+	}
+}
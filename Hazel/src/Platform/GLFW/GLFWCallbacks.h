@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Hazel/Window.h"
+
+struct GLFWwindow;
+
+
+namespace Hazel {
+
+	struct GLFWWindowData {
+	// What a GLFW window (WindowsWindow, LinuxWindow) keeps about itself, and hands to its GLFW callbacks through glfwSetWindowUserPointer().
+
+		std::string Title;
+		unsigned int Width, Height;
+		bool VSync;
+		bool Headless;
+		float MouseX = 0.0f, MouseY = 0.0f; // last cursor position, to give MouseMovedEvents their delta
+
+		Window::EventCallbackFn EventCallback;	// eg. "void Application::OnEvent(Event& e);"
+		EventQueue* Queue = nullptr;			// Application's EventQueue. If set, callbacks queue their events here rather than calling EventCallback.
+	};
+
+	// Points the window's user pointer at data, and sets the GLFW callbacks that turn the window's input and window events into Hazel
+	// events. Those are queued in data.Queue, to be dispatched in the next frame's event stage, or dispatched to data.EventCallback right
+	// away when there's no queue. data has to stay where it is for as long as the window exists.
+	void SetGLFWCallbacks(GLFWwindow* window, GLFWWindowData& data);
+}
@@ -0,0 +1,47 @@
+#include "hzpch.h"
+#include "LinuxInput.h"
+
+#include "Hazel/Application.h"
+#include <GLFW/glfw3.h>
+
+
+namespace Hazel {
+
+	Input* Input::s_Instance = new LinuxInput();
+
+	bool LinuxInput::IsKeyPressedImpl(int keycode) const {
+
+		auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+		auto state = glfwGetKey(window, keycode);
+		return state == GLFW_PRESS || state == GLFW_REPEAT;
+	}
+
+	bool LinuxInput::IsMouseButtonPressedImpl(int button) const {
+
+		auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+		auto state = glfwGetMouseButton(window, button);
+		return state == GLFW_PRESS;
+	}
+
+	std::pair<float, float> LinuxInput::GetMousePositionImpl() const {
+
+		auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+		double xpos, ypos;
+		glfwGetCursorPos(window, &xpos, &ypos);
+
+		return std::pair<float, float>((float)xpos, (float)ypos);
+	}
+
+	float LinuxInput::GetMouseXImpl() const {
+
+		auto[x, y] = GetMousePositionImpl();
+		return x;
+	}
+
+	float LinuxInput::GetMouseYImpl() const {
+
+		auto[x, y] = GetMousePositionImpl();
+		return y;
+	}
+
+}
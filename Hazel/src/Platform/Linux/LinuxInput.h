@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Hazel/Input.h"
+
+
+namespace Hazel {
+
+	// Polls GLFW like WindowsInput does. On a headless window nothing is ever pressed, and the mouse stays where it started.
+	class LinuxInput : public Input {
+
+	protected:
+
+		virtual bool IsKeyPressedImpl(int keycode) const override;
+
+		virtual bool IsMouseButtonPressedImpl(int button) const override;
+		virtual std::pair<float, float> GetMousePositionImpl() const override;
+		virtual float GetMouseXImpl() const override;
+		virtual float GetMouseYImpl() const override;
+	};
+}
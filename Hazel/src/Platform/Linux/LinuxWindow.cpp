@@ -0,0 +1,154 @@
+#include "hzpch.h"
+#include "LinuxWindow.h"
+
+#include "Hazel/Renderer/RenderThread.h"
+
+#include "Platform/OpenGL/OpenGLContext.h"
+
+#include <cstdlib>
+#include <cstring>
+
+
+namespace Hazel {
+
+	static bool s_GLFWInitialized = false;
+
+	static void GLFWErrorCallback(int error, const char* description) {
+		HZ_CORE_ERROR("GLFW Error ({0}): {1}", error, description);
+	}
+
+	// HZ_HEADLESS=1 in the environment makes any application headless, so CI can run the Sandbox and benchmarks as they are.
+	static bool IsHeadlessForced() {
+
+		const char* value = std::getenv("HZ_HEADLESS");
+		return value && std::strcmp(value, "0") != 0;
+	}
+
+	Window* Window::Create(const WindowProps& props) {
+		return new LinuxWindow(props);
+	}
+
+	LinuxWindow::LinuxWindow(const WindowProps& props) {
+		Init(props);
+	}
+
+	LinuxWindow::~LinuxWindow() {
+		Shutdown();
+	}
+
+	void LinuxWindow::Init(const WindowProps& props) {
+
+		HZ_PROFILE_FUNCTION();
+
+		m_Data.Title = props.Title;
+		m_Data.Width = props.Width;
+		m_Data.Height = props.Height;
+		m_Data.Headless = props.Headless || IsHeadlessForced();
+
+		HZ_CORE_INFO("Creating {0}window {1} ({2}, {3})", m_Data.Headless ? "headless " : "", props.Title, props.Width, props.Height);
+
+		if (!s_GLFWInitialized) {
+
+#if GLFW_VERSION_MAJOR > 3 || (GLFW_VERSION_MAJOR == 3 && GLFW_VERSION_MINOR >= 4)
+			// The null platform needs no display server at all. It has to be chosen before glfwInit(), so for the whole process.
+			if (m_Data.Headless)
+				glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#endif
+			int success = glfwInit();
+			HZ_CORE_ASSERT(success, "Could not intialize GLFW!");
+
+			glfwSetErrorCallback(GLFWErrorCallback);
+			s_GLFWInitialized = true;
+		}
+
+		if (m_Data.Headless)
+			m_Window = CreateHeadlessWindow(props);
+		else
+			m_Window = glfwCreateWindow((int)props.Width, (int)props.Height, m_Data.Title.c_str(), nullptr, nullptr);
+
+		HZ_CORE_ASSERT(m_Window, "Could not create the window!");
+
+		m_Context = new OpenGLContext(m_Window);
+		m_Context->Init();
+
+		SetVSync(!m_Data.Headless); // nothing to sync to without a display
+		SetGLFWCallbacks(m_Window, m_Data);
+	}
+
+	// An offscreen context: EGL first (surfaceless with GLFW's null platform, so a GPU if there is one, else Mesa's llvmpipe), and
+	// OSMesa as a last resort. GLFW loads libEGL/libOSMesa at runtime, so neither needs to be linked.
+	GLFWwindow* LinuxWindow::CreateHeadlessWindow(const WindowProps& props) {
+
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+		glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+		GLFWwindow* window = glfwCreateWindow((int)props.Width, (int)props.Height, m_Data.Title.c_str(), nullptr, nullptr);
+
+		if (!window) {
+			HZ_CORE_WARN("No EGL context for the headless window, falling back to OSMesa (software rendering).");
+			glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+			window = glfwCreateWindow((int)props.Width, (int)props.Height, m_Data.Title.c_str(), nullptr, nullptr);
+		}
+
+		glfwDefaultWindowHints();
+		return window;
+	}
+
+	void LinuxWindow::Shutdown() {
+
+		delete m_Context;
+		glfwDestroyWindow(m_Window);
+	}
+
+	void LinuxWindow::OnUpdate() {
+
+		PollEvents();
+		SwapBuffers();
+	}
+
+	void LinuxWindow::PollEvents() {
+
+		HZ_PROFILE_FUNCTION();
+		glfwPollEvents();
+	}
+
+	void LinuxWindow::SwapBuffers() {
+
+		HZ_PROFILE_FUNCTION();
+		m_Context->SwapBuffers();
+	}
+
+	void LinuxWindow::WaitEvents(double timeout) {
+
+		if (timeout > 0.0)
+			glfwWaitEventsTimeout(timeout);
+		else
+			glfwWaitEvents();
+	}
+
+	void LinuxWindow::Wake() {
+		glfwPostEmptyEvent();
+	}
+
+	float LinuxWindow::GetRefreshRate() const {
+
+		GLFWmonitor* monitor = glfwGetWindowMonitor(m_Window);
+		if (!monitor)
+			monitor = glfwGetPrimaryMonitor();
+
+		const GLFWvidmode* mode = monitor ? glfwGetVideoMode(monitor) : nullptr;
+		return mode ? (float)mode->refreshRate : 60.0f;
+	}
+
+	void LinuxWindow::SetVSync(bool enabled) {
+
+		// Needs the context to be current, so it's done on the render thread when there is one.
+		RenderThread::Get().Submit([enabled]() { glfwSwapInterval(enabled ? 1 : 0); });
+		m_Data.VSync = enabled;
+	}
+
+	bool LinuxWindow::IsVSync() const {
+		return m_Data.VSync;
+	}
+
+}
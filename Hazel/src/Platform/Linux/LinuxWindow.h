@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Hazel/Window.h"
+#include "Hazel/Renderer/GraphicsContext.h"
+
+#include "Platform/GLFW/GLFWCallbacks.h"
+
+#include <GLFW/glfw3.h>
+
+
+namespace Hazel {
+
+	// Contains implementation for Linux. GLFW picks X11 or Wayland by itself, or its "null" platform with an offscreen context when headless.
+	class LinuxWindow : public Window
+	{
+	public:
+
+		LinuxWindow(const WindowProps& props);
+		virtual ~LinuxWindow();
+
+		void OnUpdate() override;
+		void PollEvents() override;
+		void SwapBuffers() override;
+		void WaitEvents(double timeout = 0.0) override;
+		void Wake() override;
+
+		inline unsigned int GetWidth() const override { return m_Data.Width; }
+		inline unsigned int GetHeight() const override { return m_Data.Height; }
+		float GetRefreshRate() const override;
+		inline bool IsHeadless() const override { return m_Data.Headless; }
+
+		inline void SetEventCallback(const EventCallbackFn& callback) override { m_Data.EventCallback = callback; }
+		inline void SetEventQueue(EventQueue* queue) override { m_Data.Queue = queue; }
+
+		void SetVSync(bool enabled) override;
+		bool IsVSync() const override;
+
+		inline virtual void* GetNativeWindow() const override { return m_Window; }
+		inline virtual GraphicsContext& GetGraphicsContext() override { return *m_Context; }
+
+	private:
+
+		virtual void Init(const WindowProps& props);
+		virtual void Shutdown();
+
+		GLFWwindow* CreateHeadlessWindow(const WindowProps& props);
+
+	private:
+
+		GLFWwindow* m_Window;
+		GraphicsContext* m_Context;
+
+		GLFWWindowData m_Data;
+	};
+
+}
@@ -0,0 +1,92 @@
+#include "hzpch.h"
+#include "NullBuffer.h"
+
+#include "NullCommandRecorder.h"
+
+
+namespace Hazel {
+
+	// VertexBuffer ----------------------------------------------------------------------------------------------------------------------
+
+	NullVertexBuffer::NullVertexBuffer(float* vertices, uint32_t size)
+		: m_ID(NullCommandRecorder::Get().NextID())
+	{
+		Bind();
+		NullCommandRecorder::Get().Upload(m_ID, size);
+	}
+
+	NullVertexBuffer::NullVertexBuffer(uint32_t size)
+		: m_ID(NullCommandRecorder::Get().NextID())
+	{
+		Bind(); // allocated, but nothing uploaded yet
+	}
+
+	void NullVertexBuffer::Bind() const {
+		NullCommandRecorder::Get().Bind(NullCommandType::BindVertexBuffer, m_ID);
+	}
+
+	void NullVertexBuffer::Unbind() const {
+		NullCommandRecorder::Get().Bind(NullCommandType::BindVertexBuffer, 0);
+	}
+
+	void NullVertexBuffer::SetData(const void* data, uint32_t size) {
+
+		Bind();
+		NullCommandRecorder::Get().Upload(m_ID, size);
+	}
+
+	// StreamingVertexBuffer -------------------------------------------------------------------------------------------------------------
+
+	NullStreamingVertexBuffer::NullStreamingVertexBuffer(uint32_t segmentSize, uint32_t segmentCount)
+		: m_ID(NullCommandRecorder::Get().NextID()), m_SegmentSize(segmentSize), m_SegmentCount(segmentCount)
+	{
+		HZ_CORE_ASSERT(segmentCount > 1, "A streaming buffer needs at least 2 segments!");
+		Bind();
+	}
+
+	void NullStreamingVertexBuffer::Bind() const {
+		NullCommandRecorder::Get().Bind(NullCommandType::BindVertexBuffer, m_ID);
+	}
+
+	void NullStreamingVertexBuffer::Unbind() const {
+		NullCommandRecorder::Get().Bind(NullCommandType::BindVertexBuffer, 0);
+	}
+
+	void NullStreamingVertexBuffer::SetData(const void* data, uint32_t size) {
+		HZ_CORE_ASSERT(false, "Streaming vertex buffers are written with Write(), which says where the data went!");
+	}
+
+	uint32_t NullStreamingVertexBuffer::Write(const void* data, uint32_t size) {
+
+		HZ_CORE_ASSERT(size <= m_SegmentSize, "Write is bigger than a segment of the streaming vertex buffer!");
+
+		if (m_SegmentOffset + size > m_SegmentSize) {
+			m_Segment = (m_Segment + 1) % m_SegmentCount;
+			m_SegmentOffset = 0;
+		}
+
+		uint32_t offset = m_Segment * m_SegmentSize + m_SegmentOffset;
+		m_SegmentOffset += size;
+
+		// A memcpy into mapped memory, no bind needed. (like the persistently mapped OpenGL buffer)
+		NullCommandRecorder::Get().Upload(m_ID, size);
+		return offset;
+	}
+
+	// IndexBuffer -----------------------------------------------------------------------------------------------------------------------
+
+	NullIndexBuffer::NullIndexBuffer(uint32_t* indices, uint32_t count)
+		: m_ID(NullCommandRecorder::Get().NextID()), m_Count(count)
+	{
+		Bind();
+		NullCommandRecorder::Get().Upload(m_ID, count * sizeof(uint32_t));
+	}
+
+	void NullIndexBuffer::Bind() const {
+		NullCommandRecorder::Get().Bind(NullCommandType::BindIndexBuffer, m_ID);
+	}
+
+	void NullIndexBuffer::Unbind() const {
+		NullCommandRecorder::Get().Bind(NullCommandType::BindIndexBuffer, 0);
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Hazel/Renderer/Buffer.h"
+
+
+namespace Hazel {
+
+	// Keeps no data, only records the binds and uploads with the NullCommandRecorder.
+	class NullVertexBuffer : public VertexBuffer {
+
+	public:
+
+		NullVertexBuffer(float* vertices, uint32_t size);
+		NullVertexBuffer(uint32_t size);
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual void SetData(const void* data, uint32_t size) override;
+
+		inline virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		inline virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		inline uint32_t GetID() const { return m_ID; }
+
+	private:
+
+		uint32_t m_ID;
+		BufferLayout m_Layout;
+	};
+
+	// Moves through its segments the same way OpenGLStreamingVertexBuffer does, so the offsets (and so the base vertices) match.
+	class NullStreamingVertexBuffer : public StreamingVertexBuffer {
+
+	public:
+
+		NullStreamingVertexBuffer(uint32_t segmentSize, uint32_t segmentCount);
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual void SetData(const void* data, uint32_t size) override;
+		virtual uint32_t Write(const void* data, uint32_t size) override;
+
+		inline virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		inline virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		inline uint32_t GetID() const { return m_ID; }
+
+	private:
+
+		uint32_t m_ID;
+		BufferLayout m_Layout;
+
+		uint32_t m_SegmentSize, m_SegmentCount;
+		uint32_t m_Segment = 0;
+		uint32_t m_SegmentOffset = 0;
+	};
+
+	class NullIndexBuffer : public IndexBuffer {
+
+	public:
+
+		NullIndexBuffer(uint32_t* indices, uint32_t count);
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		inline virtual uint32_t GetCount() const override { return m_Count; }
+
+		inline uint32_t GetID() const { return m_ID; }
+
+	private:
+
+		uint32_t m_ID;
+		uint32_t m_Count;
+	};
+}
@@ -0,0 +1,111 @@
+#include "hzpch.h"
+#include "NullCommandRecorder.h"
+
+
+namespace Hazel {
+
+	static thread_local NullCommandRecorder* t_CurrentRecorder = nullptr;
+
+	NullCommandRecorder& NullCommandRecorder::Get() {
+
+		static NullCommandRecorder instance;
+		return t_CurrentRecorder ? *t_CurrentRecorder : instance;
+	}
+
+	NullCommandRecorder* NullCommandRecorder::SetCurrent(NullCommandRecorder* recorder) {
+
+		NullCommandRecorder* previous = t_CurrentRecorder;
+		t_CurrentRecorder = recorder;
+		return previous;
+	}
+
+	void NullCommandRecorder::Reset() {
+
+		m_Stream.clear();
+		m_Stats = NullRenderStats();
+	}
+
+	void NullCommandRecorder::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+
+		NullViewportCommand command = { x, y, width, height };
+		CountStateChange(std::memcmp(&command, &m_Viewport, sizeof(command)) == 0);
+		m_Viewport = command;
+		Record(NullCommandType::SetViewport, command);
+	}
+
+	void NullCommandRecorder::SetClearColor(const float color[4]) {
+
+		NullClearColorCommand command;
+		std::memcpy(command.Color, color, sizeof(command.Color));
+		CountStateChange(std::memcmp(command.Color, m_ClearColor, sizeof(m_ClearColor)) == 0);
+		std::memcpy(m_ClearColor, color, sizeof(m_ClearColor));
+		Record(NullCommandType::SetClearColor, command);
+	}
+
+	void NullCommandRecorder::Clear() {
+
+		m_Stats.Clears++;
+		Record(NullCommandType::Clear, uint8_t(0));
+	}
+
+	void NullCommandRecorder::Bind(NullCommandType type, uint32_t id) {
+
+		HZ_CORE_ASSERT(type >= NullCommandType::BindShader && type <= NullCommandType::BindIndexBuffer, "Not a bind command!");
+
+		CountStateChange(m_Bound[(int)type] == id);
+		m_Bound[(int)type] = id;
+		Record(type, NullBindCommand{ id });
+	}
+
+	void NullCommandRecorder::BindTexture(uint32_t slot, uint32_t id) {
+
+		HZ_CORE_ASSERT(slot < MaxTextureSlots, "Texture slot out of range!");
+
+		CountStateChange(m_BoundTextures[slot] == id);
+		m_BoundTextures[slot] = id;
+		Record(NullCommandType::BindTexture, NullBindTextureCommand{ slot, id });
+	}
+
+	void NullCommandRecorder::SetLineWidth(float width) {
+
+		CountStateChange(m_LineWidth == width);
+		m_LineWidth = width;
+		Record(NullCommandType::SetLineWidth, NullLineWidthCommand{ width });
+	}
+
+	void NullCommandRecorder::SetBlendMode(uint32_t mode) {
+
+		CountStateChange(m_BlendMode == mode);
+		m_BlendMode = mode;
+		Record(NullCommandType::SetBlendMode, NullBlendModeCommand{ mode });
+	}
+
+	void NullCommandRecorder::Upload(uint32_t bufferID, uint32_t size) {
+
+		m_Stats.BufferUploads++;
+		m_Stats.BytesUploaded += size;
+		Record(NullCommandType::UploadBuffer, NullUploadCommand{ bufferID, size });
+	}
+
+	void NullCommandRecorder::DrawIndexed(uint32_t vertexArrayID, uint32_t indexCount, uint32_t baseVertex, uint32_t instanceCount) {
+
+		m_Stats.DrawCalls++;
+		m_Stats.Indices += indexCount;
+		m_Stats.Instances += instanceCount;
+		Record(NullCommandType::DrawIndexed, NullDrawIndexedCommand{ vertexArrayID, indexCount, baseVertex, instanceCount });
+	}
+
+	void NullCommandRecorder::DrawLines(uint32_t vertexArrayID, uint32_t vertexCount, uint32_t firstVertex) {
+
+		m_Stats.DrawCalls++;
+		m_Stats.Vertices += vertexCount;
+		Record(NullCommandType::DrawLines, NullDrawLinesCommand{ vertexArrayID, vertexCount, firstVertex });
+	}
+
+	void NullCommandRecorder::CountStateChange(bool redundant) {
+
+		m_Stats.StateChanges++;
+		if (redundant)
+			m_Stats.RedundantStateChanges++;
+	}
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Hazel/Core.h"
+
+#include <cstring>
+#include <vector>
+
+
+namespace Hazel {
+
+	enum class NullCommandType : uint8_t {
+		SetViewport = 0, SetClearColor, Clear, BindShader, BindVertexArray, BindVertexBuffer, BindIndexBuffer, UploadBuffer, DrawIndexed,
+		BindTexture, SetLineWidth, DrawLines, SetBlendMode
+	};
+
+	// Payloads, stored right after their NullCommandHeader in the command stream.
+	struct NullViewportCommand		{ uint32_t X, Y, Width, Height; };
+	struct NullClearColorCommand	{ float Color[4]; };
+	struct NullBindCommand			{ uint32_t ID; }; // 0 unbinds
+	struct NullUploadCommand		{ uint32_t BufferID, Size; };
+	struct NullDrawIndexedCommand	{ uint32_t VertexArrayID, IndexCount, BaseVertex, InstanceCount; };
+	struct NullBindTextureCommand	{ uint32_t Slot, ID; };
+	struct NullLineWidthCommand		{ float Width; };
+	struct NullBlendModeCommand		{ uint32_t Mode; }; // a Hazel::BlendMode
+	struct NullDrawLinesCommand		{ uint32_t VertexArrayID, VertexCount, FirstVertex; };
+
+	struct NullCommandHeader {
+
+		NullCommandType Type;
+		uint8_t PayloadSize;
+	};
+
+	// Totals since the last Reset().
+	struct NullRenderStats {
+
+		uint32_t Commands = 0;
+		uint32_t DrawCalls = 0;
+		uint64_t Indices = 0;				// per instance, ie. a draw of 6 indices and 100 instances counts 6
+		uint64_t Instances = 0;
+		uint64_t Vertices = 0;				// of the line draws
+		uint32_t StateChanges = 0;			// binds, viewport, clear color, line width and blend changes
+		uint32_t RedundantStateChanges = 0;	// of which set what was already set
+		uint32_t Clears = 0;
+		uint32_t BufferUploads = 0;
+		uint64_t BytesUploaded = 0;
+	};
+
+
+	class NullCommandRecorder {
+	// What the Null RendererAPI "renders" into: every call becomes a small header + payload in one flat byte buffer, and is counted in
+	// NullRenderStats. It also tracks what's currently bound the way a GL context would, so redundant binds show up in the stats.
+	public:
+
+		void Reset(); // clears the commands and stats, keeps the bindings (like a context does between frames)
+
+		// Off, only the stats are kept. (for long benchmarks, where the stream would just grow)
+		inline void SetStreamEnabled(bool enabled) { m_StreamEnabled = enabled; }
+
+		void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+		void SetClearColor(const float color[4]);
+		void Clear();
+		void Bind(NullCommandType type, uint32_t id); // one of BindShader, BindVertexArray, BindVertexBuffer or BindIndexBuffer
+		void BindTexture(uint32_t slot, uint32_t id);
+		void SetLineWidth(float width);
+		void SetBlendMode(uint32_t mode);
+		void Upload(uint32_t bufferID, uint32_t size);
+		void DrawIndexed(uint32_t vertexArrayID, uint32_t indexCount, uint32_t baseVertex = 0, uint32_t instanceCount = 1);
+		void DrawLines(uint32_t vertexArrayID, uint32_t vertexCount, uint32_t firstVertex = 0);
+
+		inline const NullRenderStats& GetStats() const { return m_Stats; }
+		inline const std::vector<uint8_t>& GetStream() const { return m_Stream; }
+
+		// Calls func(NullCommandType, const void* payload) for every recorded command, in order.
+		template<typename F>
+		void ForEach(F&& func) const {
+
+			size_t offset = 0;
+			while (offset < m_Stream.size()) {
+
+				NullCommandHeader header;
+				std::memcpy(&header, m_Stream.data() + offset, sizeof(header));
+				func(header.Type, m_Stream.data() + offset + sizeof(header));
+				offset += sizeof(header) + header.PayloadSize;
+			}
+		}
+
+		// IDs for the Null buffers, vertex arrays and shaders. (never 0)
+		inline uint32_t NextID() { return ++m_LastID; }
+
+		// The recorder the Null API and objects record into on the calling thread: the engine's own, unless a ScopedNullCommandRecorder
+		// says otherwise.
+		static NullCommandRecorder& Get();
+		// nullptr goes back to the engine's own. Returns the previous one, (nullptr if it was the engine's own) see ScopedNullCommandRecorder.
+		static NullCommandRecorder* SetCurrent(NullCommandRecorder* recorder);
+
+		static constexpr uint32_t MaxTextureSlots = 32;
+
+	private:
+
+		template<typename T>
+		void Record(NullCommandType type, const T& payload) {
+
+			m_Stats.Commands++;
+			if (!m_StreamEnabled)
+				return;
+
+			static_assert(sizeof(T) <= 255, "Command payload too big for NullCommandHeader::PayloadSize");
+			NullCommandHeader header = { type, (uint8_t)sizeof(T) };
+
+			size_t offset = m_Stream.size();
+			m_Stream.resize(offset + sizeof(header) + sizeof(T));
+			std::memcpy(m_Stream.data() + offset, &header, sizeof(header));
+			std::memcpy(m_Stream.data() + offset + sizeof(header), &payload, sizeof(T));
+		}
+
+		void CountStateChange(bool redundant);
+
+	private:
+
+		std::vector<uint8_t> m_Stream;
+		bool m_StreamEnabled = true;
+		NullRenderStats m_Stats;
+		uint32_t m_LastID = 0;
+
+		// Current bindings, indexed by NullCommandType (only the Bind* ones are used)
+		uint32_t m_Bound[(int)NullCommandType::DrawIndexed + 1] = {};
+		NullViewportCommand m_Viewport = {};
+		float m_ClearColor[4] = {};
+		uint32_t m_BoundTextures[MaxTextureSlots] = {};
+		float m_LineWidth = 1.0f;
+		uint32_t m_BlendMode = 0;
+	};
+
+
+	class ScopedNullCommandRecorder {
+	// Records the calling thread's Null commands into recorder until the end of the scope, eg. so that a benchmark or test gets a stream
+	// of its own, without resetting (or disabling) the engine's. Null objects should be created in the scope too, since IDs come from
+	// the recorder, and another recorder's IDs can collide with them.
+	public:
+
+		ScopedNullCommandRecorder(NullCommandRecorder& recorder)
+			: m_Previous(NullCommandRecorder::SetCurrent(&recorder)) {}
+
+		~ScopedNullCommandRecorder() {
+			NullCommandRecorder::SetCurrent(m_Previous);
+		}
+
+		ScopedNullCommandRecorder(const ScopedNullCommandRecorder&) = delete;
+		ScopedNullCommandRecorder& operator=(const ScopedNullCommandRecorder&) = delete;
+
+	private:
+
+		NullCommandRecorder* m_Previous;
+	};
+}
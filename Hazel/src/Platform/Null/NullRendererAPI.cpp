@@ -0,0 +1,69 @@
+#include "hzpch.h"
+#include "NullRendererAPI.h"
+#include "NullVertexArray.h"
+
+
+namespace Hazel {
+
+	void NullRendererAPI::Init() {
+
+		NullCommandRecorder::Get().Reset();
+		SetBlendMode(BlendMode::Alpha);
+	}
+
+	void NullRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+		NullCommandRecorder::Get().SetViewport(x, y, width, height);
+	}
+
+	void NullRendererAPI::SetClearColor(const glm::vec4& color) {
+
+		float rgba[4] = { color.r, color.g, color.b, color.a };
+		NullCommandRecorder::Get().SetClearColor(rgba);
+	}
+
+	void NullRendererAPI::Clear() {
+		NullCommandRecorder::Get().Clear();
+	}
+
+	void NullRendererAPI::SetBlendMode(BlendMode mode) {
+		NullCommandRecorder::Get().SetBlendMode((uint32_t)mode);
+	}
+
+	void NullRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseVertex) {
+
+		vertexArray->Bind();
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		NullCommandRecorder::Get().DrawIndexed(static_cast<NullVertexArray*>(vertexArray.get())->GetID(), count, baseVertex);
+	}
+
+	void NullRendererAPI::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount) {
+
+		vertexArray->Bind();
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		NullCommandRecorder::Get().DrawIndexed(static_cast<NullVertexArray*>(vertexArray.get())->GetID(), count, 0, instanceCount);
+	}
+
+	void NullRendererAPI::DrawLines(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex) {
+
+		vertexArray->Bind();
+		NullCommandRecorder::Get().DrawLines(static_cast<NullVertexArray*>(vertexArray.get())->GetID(), vertexCount, firstVertex);
+	}
+
+	void NullRendererAPI::SetLineWidth(float width) {
+		NullCommandRecorder::Get().SetLineWidth(width);
+	}
+
+	// What GL guarantees at the least, so that batches break where they would on the weakest OpenGL implementation.
+	uint32_t NullRendererAPI::GetMaxTextureSlots() const {
+		return 16;
+	}
+
+	// Nothing to time without a GPU.
+	void NullRendererAPI::BeginGPUFrame() {}
+	void NullRendererAPI::EndGPUFrame() {}
+	void NullRendererAPI::BeginGPUScope(const char* name) {}
+	void NullRendererAPI::EndGPUScope() {}
+
+	// Null shaders aren't compiled, so there's nothing to cache.
+	void NullRendererAPI::LogShaderCacheStats() const {}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Hazel/Renderer/RendererAPI.h"
+#include "NullCommandRecorder.h"
+
+
+namespace Hazel {
+
+	class NullRendererAPI : public RendererAPI {
+	// Records into NullCommandRecorder::Get() instead of drawing, so draw calls, state changes and uploads can be counted (and the CPU 
+	// cost of submitting them measured) without a GPU. Select it with RendererAPI::SetAPI(RendererAPI::API::Null) or HZ_RENDERER_API=null.
+	public:
+
+		virtual void Init() override;
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+		virtual void SetClearColor(const glm::vec4& color) override;
+		virtual void Clear() override;
+		virtual void SetBlendMode(BlendMode mode) override;
+
+		virtual void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) override;
+		virtual void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) override;
+		virtual void DrawLines(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) override;
+		virtual void SetLineWidth(float width) override;
+
+		virtual uint32_t GetMaxTextureSlots() const override;
+
+		virtual void BeginGPUFrame() override;
+		virtual void EndGPUFrame() override;
+		virtual void BeginGPUScope(const char* name) override;
+		virtual void EndGPUScope() override;
+
+		virtual void LogShaderCacheStats() const override;
+	};
+}
@@ -0,0 +1,20 @@
+#include "hzpch.h"
+#include "NullShader.h"
+
+#include "NullCommandRecorder.h"
+
+
+namespace Hazel {
+
+	NullShader::NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
+		: m_ID(NullCommandRecorder::Get().NextID()), m_Name(name)
+	{}
+
+	void NullShader::Bind() const {
+		NullCommandRecorder::Get().Bind(NullCommandType::BindShader, m_ID);
+	}
+
+	void NullShader::Unbind() const {
+		NullCommandRecorder::Get().Bind(NullCommandType::BindShader, 0);
+	}
+}
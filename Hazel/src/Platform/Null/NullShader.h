@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Hazel/Renderer/Shader.h"
+
+
+namespace Hazel {
+
+	// Doesn't compile anything, binding it is recorded with the NullCommandRecorder.
+	class NullShader : public Shader {
+
+	public:
+
+		NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		// Uniforms aren't recorded, they're not state the recorder tracks.
+		inline virtual void SetInt(const std::string& name, int value) override {}
+		inline virtual void SetIntArray(const std::string& name, const int* values, uint32_t count) override {}
+		inline virtual void SetFloat(const std::string& name, float value) override {}
+		inline virtual void SetFloat2(const std::string& name, const glm::vec2& value) override {}
+		inline virtual void SetFloat3(const std::string& name, const glm::vec3& value) override {}
+		inline virtual void SetFloat4(const std::string& name, const glm::vec4& value) override {}
+		inline virtual void SetMat4(const std::string& name, const glm::mat4& value) override {}
+
+		inline virtual bool IsReady() const override { return true; }
+		inline virtual void WaitUntilReady() const override {}
+		inline virtual void Reload(const std::string& vertexSrc, const std::string& fragmentSrc) override {}
+
+		inline virtual const std::string& GetName() const override { return m_Name; }
+
+	private:
+
+		uint32_t m_ID;
+		std::string m_Name;
+	};
+}
@@ -0,0 +1,22 @@
+#include "hzpch.h"
+#include "NullTexture.h"
+
+#include "NullCommandRecorder.h"
+
+
+namespace Hazel {
+
+	NullTexture2D::NullTexture2D(uint32_t width, uint32_t height)
+		: m_Width(width), m_Height(height), m_ID(NullCommandRecorder::Get().NextID())
+	{}
+
+	void NullTexture2D::SetData(const void* data, uint32_t size) {
+
+		HZ_CORE_ASSERT(size == m_Width * m_Height * 4, "Data must be the entire texture!");
+		NullCommandRecorder::Get().Upload(m_ID, size);
+	}
+
+	void NullTexture2D::Bind(uint32_t slot) const {
+		NullCommandRecorder::Get().BindTexture(slot, m_ID);
+	}
+}
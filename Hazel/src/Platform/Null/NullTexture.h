@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Hazel/Renderer/Texture.h"
+
+
+namespace Hazel {
+
+	class NullTexture2D : public Texture2D {
+
+	public:
+
+		NullTexture2D(uint32_t width, uint32_t height);
+
+		inline virtual uint32_t GetWidth() const override { return m_Width; }
+		inline virtual uint32_t GetHeight() const override { return m_Height; }
+
+		virtual void SetData(const void* data, uint32_t size) override;
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		inline virtual bool operator==(const Texture& other) const override {
+			return m_ID == static_cast<const NullTexture2D&>(other).m_ID;
+		}
+
+	private:
+
+		uint32_t m_Width, m_Height;
+		uint32_t m_ID;
+	};
+}
@@ -0,0 +1,37 @@
+#include "hzpch.h"
+#include "NullVertexArray.h"
+
+#include "NullCommandRecorder.h"
+
+
+namespace Hazel {
+
+	NullVertexArray::NullVertexArray()
+		: m_ID(NullCommandRecorder::Get().NextID())
+	{}
+
+	void NullVertexArray::Bind() const {
+		NullCommandRecorder::Get().Bind(NullCommandType::BindVertexArray, m_ID);
+	}
+
+	void NullVertexArray::Unbind() const {
+		NullCommandRecorder::Get().Bind(NullCommandType::BindVertexArray, 0);
+	}
+
+	// Same binds as OpenGLVertexArray does, so the counts match what the OpenGL backend would issue.
+	void NullVertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) {
+
+		HZ_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+
+		Bind();
+		vertexBuffer->Bind();
+		m_VertexBuffers.push_back(vertexBuffer);
+	}
+
+	void NullVertexArray::SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) {
+
+		Bind();
+		indexBuffer->Bind();
+		m_IndexBuffer = indexBuffer;
+	}
+}
@@ -0,0 +1,212 @@
+#include "hzpch.h"
+#include "OpenGLBuffer.h"
+
+#include "OpenGLStateCache.h"
+
+#include "Hazel/Renderer/RenderThread.h"
+
+#include <glad/glad.h>
+
+#include <cstring>
+
+
+namespace Hazel {
+
+	// VertexBuffer ----------------------------------------------------------------------------------------------------------------------
+
+	OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size) {
+
+		RenderThread::Get().SubmitAndWait([&]() {
+			glGenBuffers(1, &m_RendererID);
+			OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+			glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+		});
+	}
+
+	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size) {
+
+		RenderThread::Get().SubmitAndWait([&]() {
+			glGenBuffers(1, &m_RendererID);
+			OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+			glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+		});
+	}
+
+	OpenGLVertexBuffer::~OpenGLVertexBuffer() {
+
+		RenderThread::Get().Submit([rendererID = m_RendererID]() {
+			OpenGLStateCache::Get().OnDeleteBuffer(rendererID);
+			glDeleteBuffers(1, &rendererID);
+		});
+	}
+
+	void OpenGLVertexBuffer::Bind() const {
+		RenderThread::Get().Submit([rendererID = m_RendererID]() { OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, rendererID); });
+	}
+
+	void OpenGLVertexBuffer::Unbind() const {
+		RenderThread::Get().Submit([]() { OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0); });
+	}
+
+	void OpenGLVertexBuffer::SetData(const void* data, uint32_t size) {
+
+		const void* copy = RenderThread::Get().Copy(data, size);
+		RenderThread::Get().Submit([rendererID = m_RendererID, copy, size]() {
+			OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, rendererID);
+			glBufferSubData(GL_ARRAY_BUFFER, 0, size, copy);
+		});
+	}
+
+	// StreamingVertexBuffer -------------------------------------------------------------------------------------------------------------
+
+	OpenGLStreamingVertexBuffer::OpenGLStreamingVertexBuffer(uint32_t segmentSize, uint32_t segmentCount)
+		: m_Ring(new Ring()), m_SegmentSize(segmentSize), m_SegmentCount(segmentCount)
+	{
+		HZ_CORE_ASSERT(segmentCount > 1, "A streaming buffer needs at least 2 segments!");
+
+		m_Ring->SegmentSize = segmentSize;
+		m_Ring->SegmentCount = segmentCount;
+		m_Ring->Fences.resize(segmentCount, nullptr);
+
+		RenderThread::Get().SubmitAndWait([ring = m_Ring]() {
+
+			glGenBuffers(1, &ring->RendererID);
+			OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, ring->RendererID);
+
+			GLsizeiptr size = (GLsizeiptr)ring->SegmentSize * ring->SegmentCount;
+			if (GLAD_GL_VERSION_4_4) {
+				// Coherent, so writes are visible to the GPU without explicitly flushing them.
+				GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+				glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+				ring->MappedData = (uint8_t*)glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+				HZ_CORE_ASSERT(ring->MappedData, "Failed to map the streaming vertex buffer!");
+			}
+			else {
+				glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW);
+			}
+		});
+	}
+
+	OpenGLStreamingVertexBuffer::~OpenGLStreamingVertexBuffer() {
+
+		RenderThread::Get().Submit([ring = m_Ring]() {
+
+			for (void* fence : ring->Fences) {
+				if (fence)
+					glDeleteSync((GLsync)fence);
+			}
+
+			if (ring->MappedData) {
+				OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, ring->RendererID);
+				glUnmapBuffer(GL_ARRAY_BUFFER);
+			}
+			OpenGLStateCache::Get().OnDeleteBuffer(ring->RendererID);
+			glDeleteBuffers(1, &ring->RendererID);
+
+			delete ring;
+		});
+	}
+
+	void OpenGLStreamingVertexBuffer::Bind() const {
+		RenderThread::Get().Submit([rendererID = m_Ring->RendererID]() { OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, rendererID); });
+	}
+
+	void OpenGLStreamingVertexBuffer::Unbind() const {
+		RenderThread::Get().Submit([]() { OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0); });
+	}
+
+	void OpenGLStreamingVertexBuffer::SetData(const void* data, uint32_t size) {
+		HZ_CORE_ASSERT(false, "Streaming vertex buffers are written with Write(), which says where the data went!");
+	}
+
+	uint32_t OpenGLStreamingVertexBuffer::Write(const void* data, uint32_t size) {
+
+		HZ_CORE_ASSERT(size <= m_SegmentSize, "Write is bigger than a segment of the streaming vertex buffer!");
+
+		// The offset is known straight away, the copy itself (and any waiting on the GPU) happens when the command runs.
+		uint32_t previous = m_Segment;
+		if (m_SegmentOffset + size > m_SegmentSize) {
+			m_Segment = (m_Segment + 1) % m_SegmentCount;
+			m_SegmentOffset = 0;
+		}
+
+		uint32_t offset = m_Segment * m_SegmentSize + m_SegmentOffset;
+		m_SegmentOffset += size;
+
+		const void* copy = RenderThread::Get().Copy(data, size);
+		RenderThread::Get().Submit([ring = m_Ring, previous, next = m_Segment, offset, copy, size]() {
+
+			if (previous != next)
+				ring->EnterSegment(previous, next);
+
+			if (ring->MappedData) {
+				std::memcpy(ring->MappedData + offset, copy, size);
+			}
+			else {
+				OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, ring->RendererID);
+				glBufferSubData(GL_ARRAY_BUFFER, offset, size, copy);
+			}
+		});
+
+		return offset;
+	}
+
+	void OpenGLStreamingVertexBuffer::Ring::EnterSegment(uint32_t previous, uint32_t next) {
+
+		if (!MappedData) {
+			// Orphans the buffer when wrapping around, so the driver hands out fresh storage instead of syncing with draws in flight.
+			if (next == 0) {
+				OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, RendererID);
+				glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)SegmentSize * SegmentCount, nullptr, GL_STREAM_DRAW);
+			}
+			return;
+		}
+
+		// Every draw reading from the segment we're leaving has been issued by now, so this fence covers all of them.
+		Fences[previous] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		if (GLsync fence = (GLsync)Fences[next]) {
+
+			GLenum result = glClientWaitSync(fence, 0, 0);
+			if (result == GL_TIMEOUT_EXPIRED) {
+				HZ_PROFILE_SCOPE("StreamingVertexBuffer - GPU stall");
+				do {
+					result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1ms
+				} while (result == GL_TIMEOUT_EXPIRED);
+			}
+
+			glDeleteSync(fence);
+			Fences[next] = nullptr;
+		}
+	}
+
+	// IndexBuffer -----------------------------------------------------------------------------------------------------------------------
+
+	OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count)
+		: m_Count(count)
+	{
+		RenderThread::Get().SubmitAndWait([&]() {
+			glGenBuffers(1, &m_RendererID);
+
+			// Uploaded through GL_ARRAY_BUFFER, since binding GL_ELEMENT_ARRAY_BUFFER would attach it to whatever vertex array is bound.
+			OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+			glBufferData(GL_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+		});
+	}
+
+	OpenGLIndexBuffer::~OpenGLIndexBuffer() {
+
+		RenderThread::Get().Submit([rendererID = m_RendererID]() {
+			OpenGLStateCache::Get().OnDeleteBuffer(rendererID);
+			glDeleteBuffers(1, &rendererID);
+		});
+	}
+
+	void OpenGLIndexBuffer::Bind() const {
+		RenderThread::Get().Submit([rendererID = m_RendererID]() { OpenGLStateCache::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, rendererID); });
+	}
+
+	void OpenGLIndexBuffer::Unbind() const {
+		RenderThread::Get().Submit([]() { OpenGLStateCache::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); });
+	}
+}
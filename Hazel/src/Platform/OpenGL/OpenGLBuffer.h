@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Hazel/Renderer/Buffer.h"
+
+
+namespace Hazel {
+
+	class OpenGLVertexBuffer : public VertexBuffer {
+
+	public:
+
+		OpenGLVertexBuffer(float* vertices, uint32_t size);
+		OpenGLVertexBuffer(uint32_t size);
+		virtual ~OpenGLVertexBuffer();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual void SetData(const void* data, uint32_t size) override;
+
+		inline virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		inline virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+	private:
+
+		uint32_t m_RendererID;
+		BufferLayout m_Layout;
+	};
+
+	class OpenGLStreamingVertexBuffer : public StreamingVertexBuffer {
+	// With GL 4.4 (buffer storage) the whole ring is mapped once, persistently, and Write() is a memcpy into it. Every segment gets a 
+	// fence when the ring moves past it, which is waited on before the segment is written to again.
+	// Below 4.4 it falls back to glBufferSubData(), orphaning the buffer every time the ring wraps around.
+	public:
+
+		OpenGLStreamingVertexBuffer(uint32_t segmentSize, uint32_t segmentCount);
+		virtual ~OpenGLStreamingVertexBuffer();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual void SetData(const void* data, uint32_t size) override;
+		virtual uint32_t Write(const void* data, uint32_t size) override;
+
+		inline virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		inline virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		inline bool IsPersistentlyMapped() const { return m_Ring->MappedData != nullptr; }
+
+	private:
+
+		// The GL side of the buffer, only ever touched by render commands. Lives on after the buffer is destroyed, until the command
+		// deleting it has run. (see RenderThread)
+		struct Ring {
+
+			uint32_t RendererID = 0;
+			uint32_t SegmentSize, SegmentCount;
+			uint8_t* MappedData = nullptr;
+			std::vector<void*> Fences; // a GLsync per segment, null when the segment is free
+
+			void EnterSegment(uint32_t previous, uint32_t next);
+		};
+
+	private:
+
+		Ring* m_Ring;
+		BufferLayout m_Layout;
+
+		// Where the next Write() goes, worked out on the recording side.
+		uint32_t m_SegmentSize, m_SegmentCount;
+		uint32_t m_Segment = 0;
+		uint32_t m_SegmentOffset = 0;
+	};
+
+	class OpenGLIndexBuffer : public IndexBuffer {
+
+	public:
+
+		OpenGLIndexBuffer(uint32_t* indices, uint32_t count);
+		virtual ~OpenGLIndexBuffer();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		inline virtual uint32_t GetCount() const override { return m_Count; }
+
+	private:
+
+		uint32_t m_RendererID;
+		uint32_t m_Count;
+	};
+}
@@ -1,5 +1,11 @@
 #include "hzpch.h"
 #include "OpenGLContext.h"
+#include "OpenGLGPUProfiler.h"
+#include "OpenGLShader.h"
+#include "OpenGLShaderCache.h"
+#include "OpenGLStateCache.h"
+
+#include "Hazel/Renderer/RenderThread.h"
 
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
@@ -13,7 +19,9 @@ namespace Hazel {
 		HZ_CORE_ASSERT(windowHandle, "Window handle is null");
 	}
 
-	OpenGLContext::~OpenGLContext() {}
+	OpenGLContext::~OpenGLContext() {
+		OpenGLGPUProfiler::Get().Shutdown(); // while the context (and its queries) still exists
+	}
 
 	void OpenGLContext::Init() {
 
@@ -23,10 +31,27 @@ namespace Hazel {
 
 		HZ_CORE_DEBUGS("OpenGL Renderer: {0}", (const char*)glGetString(GL_RENDERER));
 		HZ_CORE_DEBUGS("OpenGL Version : {0}", (const char*)glGetString(GL_VERSION));
+
+		OpenGLGPUProfiler::Get().Init();
+		OpenGLShaderCache::Get().Init();
+		OpenGLShader::InitParallelCompile();
+		OpenGLStateCache::Get().Invalidate(); // a new context, nothing's known about it
 	}
 
 	void OpenGLContext::SwapBuffers() {
-		glfwSwapBuffers(m_WindowHandle);
+
+		RenderThread::Get().Submit([windowHandle = m_WindowHandle]() {
+			glfwSwapBuffers(windowHandle);
+			OpenGLStateCache::Get().EndFrame();
+		});
+	}
+
+	void OpenGLContext::MakeCurrent() {
+		glfwMakeContextCurrent(m_WindowHandle);
+	}
+
+	void OpenGLContext::ReleaseCurrent() {
+		glfwMakeContextCurrent(nullptr);
 	}
 
 }
\ No newline at end of file
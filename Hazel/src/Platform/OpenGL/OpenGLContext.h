@@ -17,6 +17,9 @@ namespace Hazel {
 		virtual void Init() override;
 		virtual void SwapBuffers() override;
 
+		virtual void MakeCurrent() override;
+		virtual void ReleaseCurrent() override;
+
 	private:
 
 		GLFWwindow* m_WindowHandle;
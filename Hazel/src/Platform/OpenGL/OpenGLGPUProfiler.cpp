@@ -0,0 +1,193 @@
+#include "hzpch.h"
+#include "OpenGLGPUProfiler.h"
+
+#include "Hazel/Renderer/RenderThread.h"
+
+#include <glad/glad.h>
+
+#include <cstring>
+
+
+namespace Hazel {
+
+	OpenGLGPUProfiler& OpenGLGPUProfiler::Get() {
+
+		static OpenGLGPUProfiler instance;
+		return instance;
+	}
+
+	void OpenGLGPUProfiler::Init() {
+
+		if (m_Supported)
+			return;
+
+		GLint counterBits = 0;
+		if (GLAD_GL_VERSION_3_3 && glQueryCounter && glGetQueryObjectui64v)
+			glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits);
+
+		if (counterBits == 0) {
+			HZ_CORE_WARN("OpenGL timer queries are not available, GPU profiling is disabled.");
+			return;
+		}
+
+		for (FrameQueries& frame : m_Frames)
+			glGenQueries(MaxScopesPerFrame * 2, frame.Queries);
+
+		m_Supported = true;
+	}
+
+	void OpenGLGPUProfiler::Shutdown() {
+
+		if (!m_Supported)
+			return;
+
+		for (FrameQueries& frame : m_Frames)
+			glDeleteQueries(MaxScopesPerFrame * 2, frame.Queries);
+
+		m_Supported = false;
+
+		std::lock_guard<std::mutex> lock(m_ResultsMutex);
+		m_LastResults.clear();
+	}
+
+	// Like every other command, these don't capture the object that records them, only values: the profiler is looked up when they run.
+	void OpenGLGPUProfiler::BeginFrame() {
+		RenderThread::Get().Submit([]() { Get().BeginFrameImpl(); });
+	}
+
+	void OpenGLGPUProfiler::EndFrame() {
+		RenderThread::Get().Submit([]() { Get().EndFrameImpl(); });
+	}
+
+	void OpenGLGPUProfiler::BeginScope(const char* name) {
+		RenderThread::Get().Submit([name]() { Get().BeginScopeImpl(name); });
+	}
+
+	void OpenGLGPUProfiler::EndScope() {
+		RenderThread::Get().Submit([]() { Get().EndScopeImpl(); });
+	}
+
+	std::vector<GPUScopeResult> OpenGLGPUProfiler::GetLastResults() const {
+
+		std::lock_guard<std::mutex> lock(m_ResultsMutex);
+		return m_LastResults;
+	}
+
+	std::vector<GPUScopeTimings> OpenGLGPUProfiler::GetScopeTimings() const {
+
+		std::lock_guard<std::mutex> lock(m_ResultsMutex);
+		return m_ScopeTimings;
+	}
+
+	uint64_t OpenGLGPUProfiler::GetSkippedFrames() const {
+
+		std::lock_guard<std::mutex> lock(m_ResultsMutex);
+		return m_SkippedFrames;
+	}
+
+	void OpenGLGPUProfiler::BeginFrameImpl() {
+
+		if (!m_Supported)
+			return;
+
+		m_FrameIndex = (m_FrameIndex + 1) % FrameLatency;
+		if (m_Frames[m_FrameIndex].Pending)
+			ReadBack(m_FrameIndex);
+
+		m_Frames[m_FrameIndex].ScopeCount = 0;
+		m_Frames[m_FrameIndex].Pending = false;
+		m_Depth = 0;
+		m_InFrame = true;
+	}
+
+	void OpenGLGPUProfiler::EndFrameImpl() {
+
+		if (!m_Supported)
+			return;
+
+		HZ_CORE_ASSERT(m_Depth == 0, "GPU scope still open at the end of the frame!");
+
+		FrameQueries& frame = m_Frames[m_FrameIndex];
+		frame.Pending = frame.ScopeCount > 0;
+		m_InFrame = false;
+	}
+
+	void OpenGLGPUProfiler::BeginScopeImpl(const char* name) {
+
+		if (!m_Supported || !m_InFrame)
+			return;
+
+		HZ_CORE_ASSERT(m_Depth < (int)MaxDepth, "GPU scopes nested too deep!");
+		if (m_Depth >= (int)MaxDepth) {
+			m_Depth++; // not recorded, but still counted so that the EndScope() calls stay balanced
+			return;
+		}
+
+		// Out of queries for this frame, the scope still goes on the stack so that its EndScope() matches, but isn't recorded.
+		FrameQueries& frame = m_Frames[m_FrameIndex];
+		uint32_t scope = frame.ScopeCount < MaxScopesPerFrame ? frame.ScopeCount++ : MaxScopesPerFrame;
+		m_ScopeStack[m_Depth] = scope;
+
+		if (scope != MaxScopesPerFrame) {
+			frame.Scopes[scope] = { name, m_Depth };
+			frame.LastQuery = frame.Queries[scope * 2];
+			glQueryCounter(frame.LastQuery, GL_TIMESTAMP);
+		}
+
+		m_Depth++;
+	}
+
+	void OpenGLGPUProfiler::EndScopeImpl() {
+
+		if (!m_Supported || !m_InFrame || m_Depth == 0)
+			return;
+
+		if (--m_Depth >= (int)MaxDepth)
+			return;
+
+		FrameQueries& frame = m_Frames[m_FrameIndex];
+		uint32_t scope = m_ScopeStack[m_Depth];
+		if (scope != MaxScopesPerFrame) {
+			frame.LastQuery = frame.Queries[scope * 2 + 1];
+			glQueryCounter(frame.LastQuery, GL_TIMESTAMP);
+		}
+	}
+
+	void OpenGLGPUProfiler::ReadBack(uint32_t frameIndex) {
+
+		FrameQueries& frame = m_Frames[frameIndex];
+
+		// The last query issued is the last one the GPU gets to. If even that one is available, the whole frame is, and nothing below blocks.
+		GLint available = 0;
+		glGetQueryObjectiv(frame.LastQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+		std::lock_guard<std::mutex> lock(m_ResultsMutex);
+		if (!available) {
+			m_SkippedFrames++;
+			return;
+		}
+
+		m_LastResults.clear();
+		for (uint32_t i = 0; i < frame.ScopeCount; i++) {
+
+			GLuint64 start = 0, end = 0;
+			glGetQueryObjectui64v(frame.Queries[i * 2], GL_QUERY_RESULT, &start);
+			glGetQueryObjectui64v(frame.Queries[i * 2 + 1], GL_QUERY_RESULT, &end);
+
+			float milliseconds = end > start ? (float)((end - start) / 1000000.0) : 0.0f;
+			m_LastResults.push_back({ frame.Scopes[i].Name, milliseconds, frame.Scopes[i].Depth });
+			GetHistory(frame.Scopes[i].Name).Push(milliseconds);
+		}
+	}
+
+	TimingHistory& OpenGLGPUProfiler::GetHistory(const char* name) {
+
+		// By value, the same literal can have a different address in every translation unit (or module) that uses it.
+		for (GPUScopeTimings& timings : m_ScopeTimings) {
+			if (std::strcmp(timings.Name, name) == 0)
+				return timings.History;
+		}
+
+		m_ScopeTimings.push_back({ name, TimingHistory() });
+		return m_ScopeTimings.back().History;
+	}
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Hazel/Core.h"
+#include "Hazel/Debug/FrameStats.h"
+#include "Hazel/Debug/Instrumentor.h"
+
+#include <mutex>
+#include <vector>
+
+
+namespace Hazel {
+
+	// GPU time of one scope, from the last frame whose queries were read back.
+	struct GPUScopeResult {
+
+		const char* Name;
+		float Milliseconds;
+		int Depth; // nesting level, 0 for top level scopes
+	};
+
+	struct GPUScopeTimings {
+
+		const char* Name;
+		TimingHistory History;
+	};
+
+
+	class OpenGLGPUProfiler {
+	// Times named scopes on the GPU with GL_TIMESTAMP queries. (glQueryCounter, rather than GL_TIME_ELAPSED, since those can't nest)
+	// Reading a query back before the GPU got to it stalls the CPU until it does, so every frame writes into its own set of queries, out
+	// of a ring of FrameLatency frames, and a frame's results are only read when its slot comes around again. A frame the GPU still
+	// hasn't finished by then is skipped instead of waited on. Without timer queries (GL < 3.3, or a driver reporting 0 counter bits,
+	// which some software renderers do) everything here is a no-op.
+	// The recording calls go through the RenderThread, like any other GL call, and the results are read back on it. The getters hand
+	// out copies, so they can be called from the main thread at any time. The engine records through RenderCommand, (the
+	// OpenGLRendererAPI forwards here) see HZ_PROFILE_GPU_SCOPE.
+	public:
+
+		static constexpr uint32_t FrameLatency = 4;
+		static constexpr uint32_t MaxScopesPerFrame = 64;
+		static constexpr uint32_t MaxDepth = 16;
+
+		OpenGLGPUProfiler(const OpenGLGPUProfiler&) = delete;
+		OpenGLGPUProfiler& operator=(const OpenGLGPUProfiler&) = delete;
+
+		// Needs the OpenGL context to be current. Queries belong to the context that created them, so every scope has to be recorded
+		// with that same context current.
+		void Init();
+		void Shutdown();
+
+		inline bool IsSupported() const { return m_Supported; }
+
+		// Reads back the oldest frame in the ring (if the GPU is done with it) and starts recording into its queries.
+		void BeginFrame();
+		void EndFrame();
+
+		// name has to outlive the profiler's results, (a string literal) it's stored as a pointer.
+		void BeginScope(const char* name);
+		void EndScope();
+
+		std::vector<GPUScopeResult> GetLastResults() const;
+		std::vector<GPUScopeTimings> GetScopeTimings() const;
+		uint64_t GetSkippedFrames() const;
+
+		static OpenGLGPUProfiler& Get();
+
+	private:
+
+		OpenGLGPUProfiler() = default;
+
+		void BeginFrameImpl();
+		void EndFrameImpl();
+		void BeginScopeImpl(const char* name);
+		void EndScopeImpl();
+
+		void ReadBack(uint32_t frameIndex);
+		TimingHistory& GetHistory(const char* name);
+
+	private:
+
+		struct ScopeQueries {
+
+			const char* Name;
+			int Depth;
+		};
+
+		// Scope i uses Queries[2 * i] for its start timestamp, and Queries[2 * i + 1] for its end.
+		struct FrameQueries {
+
+			uint32_t Queries[MaxScopesPerFrame * 2] = {};
+			ScopeQueries Scopes[MaxScopesPerFrame] = {};
+			uint32_t ScopeCount = 0;
+			uint32_t LastQuery = 0;
+			bool Pending = false; // recorded, but not read back yet
+		};
+
+		bool m_Supported = false;
+		bool m_InFrame = false;
+		FrameQueries m_Frames[FrameLatency];
+		uint32_t m_FrameIndex = 0;
+
+		uint32_t m_ScopeStack[MaxDepth] = {};
+		int m_Depth = 0;
+
+		// Written by ReadBack(), guarded by m_ResultsMutex.
+		mutable std::mutex m_ResultsMutex;
+		std::vector<GPUScopeResult> m_LastResults;
+		std::vector<GPUScopeTimings> m_ScopeTimings;
+		uint64_t m_SkippedFrames = 0;
+	};
+
+}
@@ -0,0 +1,113 @@
+#include "hzpch.h"
+#include "OpenGLRendererAPI.h"
+
+#include "OpenGLGPUProfiler.h"
+#include "OpenGLShaderCache.h"
+#include "OpenGLStateCache.h"
+
+#include "Hazel/Renderer/RenderThread.h"
+
+#include <glad/glad.h>
+
+
+namespace Hazel {
+
+	void OpenGLRendererAPI::Init() {
+
+		SetBlendMode(BlendMode::Alpha);
+
+		RenderThread::Get().SubmitAndWait([this]() {
+			GLint maxTextureSlots = 0;
+			glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureSlots);
+			m_MaxTextureSlots = (uint32_t)maxTextureSlots;
+		});
+	}
+
+	void OpenGLRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+		RenderThread::Get().Submit([x, y, width, height]() { glViewport(x, y, width, height); });
+	}
+
+	void OpenGLRendererAPI::SetClearColor(const glm::vec4& color) {
+		RenderThread::Get().Submit([color]() { glClearColor(color.r, color.g, color.b, color.a); });
+	}
+
+	void OpenGLRendererAPI::Clear() {
+		RenderThread::Get().Submit([]() { glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); });
+	}
+
+	void OpenGLRendererAPI::SetBlendMode(BlendMode mode) {
+
+		RenderThread::Get().Submit([mode]() {
+
+			switch (mode) {
+
+				case BlendMode::Opaque:
+					OpenGLStateCache::Get().SetBlend(false);
+					break;
+
+				case BlendMode::Alpha:
+					OpenGLStateCache::Get().SetBlend(true);
+					OpenGLStateCache::Get().SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+					break;
+
+				case BlendMode::Additive:
+					OpenGLStateCache::Get().SetBlend(true);
+					OpenGLStateCache::Get().SetBlendFunc(GL_SRC_ALPHA, GL_ONE);
+					break;
+			}
+		});
+	}
+
+	void OpenGLRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseVertex) {
+
+		vertexArray->Bind();
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		RenderThread::Get().Submit([count, baseVertex]() {
+			if (baseVertex)
+				glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, baseVertex);
+			else
+				glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+		});
+	}
+
+	void OpenGLRendererAPI::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount) {
+
+		vertexArray->Bind();
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		RenderThread::Get().Submit([count, instanceCount]() { glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount); });
+	}
+
+	void OpenGLRendererAPI::DrawLines(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex) {
+
+		vertexArray->Bind();
+		RenderThread::Get().Submit([vertexCount, firstVertex]() { glDrawArrays(GL_LINES, firstVertex, vertexCount); });
+	}
+
+	void OpenGLRendererAPI::SetLineWidth(float width) {
+		RenderThread::Get().Submit([width]() { glLineWidth(width); });
+	}
+
+	uint32_t OpenGLRendererAPI::GetMaxTextureSlots() const {
+		return m_MaxTextureSlots;
+	}
+
+	void OpenGLRendererAPI::BeginGPUFrame() {
+		OpenGLGPUProfiler::Get().BeginFrame();
+	}
+
+	void OpenGLRendererAPI::EndGPUFrame() {
+		OpenGLGPUProfiler::Get().EndFrame();
+	}
+
+	void OpenGLRendererAPI::BeginGPUScope(const char* name) {
+		OpenGLGPUProfiler::Get().BeginScope(name);
+	}
+
+	void OpenGLRendererAPI::EndGPUScope() {
+		OpenGLGPUProfiler::Get().EndScope();
+	}
+
+	void OpenGLRendererAPI::LogShaderCacheStats() const {
+		OpenGLShaderCache::Get().LogStats();
+	}
+}
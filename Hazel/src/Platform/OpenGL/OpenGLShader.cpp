@@ -0,0 +1,443 @@
+#include "hzpch.h"
+#include "OpenGLShader.h"
+
+#include "OpenGLShaderCache.h"
+#include "OpenGLStateCache.h"
+
+#include "Hazel/Renderer/RenderThread.h"
+#include "Hazel/Timer.h"
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <cstring>
+
+// GL_KHR_parallel_shader_compile (or the ARB one, same enums) isn't in our core only Glad.
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+
+namespace Hazel {
+
+	bool OpenGLShader::s_ParallelCompile = false;
+
+	void OpenGLShader::InitParallelCompile() {
+
+		s_ParallelCompile = false;
+		GLint extensionCount = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+		for (GLint i = 0; i < extensionCount && !s_ParallelCompile; i++) {
+			const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
+			s_ParallelCompile = std::strcmp(extension, "GL_KHR_parallel_shader_compile") == 0 
+				|| std::strcmp(extension, "GL_ARB_parallel_shader_compile") == 0;
+		}
+
+		if (!s_ParallelCompile) {
+			HZ_CORE_WARN("No parallel shader compilation on this OpenGL context, shaders finish compiling when first used or polled.");
+			return;
+		}
+
+		// As many compiler threads as the driver is willing to use. (0xffffffff is "implementation defined maximum")
+		auto maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+		if (!maxShaderCompilerThreads)
+			maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glfwGetProcAddress("glMaxShaderCompilerThreadsARB");
+		if (maxShaderCompilerThreads)
+			maxShaderCompilerThreads(0xffffffff);
+	}
+
+	OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
+		: m_Name(name) {
+
+		RenderThread::Get().SubmitAndWait([&]() { StartCompile(vertexSrc, fragmentSrc); });
+	}
+
+	void OpenGLShader::Reload(const std::string& vertexSrc, const std::string& fragmentSrc) {
+
+		HZ_PROFILE_FUNCTION();
+
+		// A reload while the last one is still compiling finishes that one first, there's only ever one pending compile.
+		WaitUntilReady();
+		RenderThread::Get().SubmitAndWait([&]() { StartCompile(vertexSrc, fragmentSrc); });
+		DeleteRetiredProgram();
+	}
+
+	void OpenGLShader::StartCompile(const std::string& vertexSrc, const std::string& fragmentSrc) {
+
+		HZ_PROFILE_FUNCTION();
+		Timer timer;
+
+		// A binary of this exact program, from a previous launch on the same driver, skips compiling and linking altogether.
+		OpenGLShaderCache& cache = OpenGLShaderCache::Get();
+		uint64_t key = cache.GetKey({ vertexSrc, fragmentSrc });
+		if (GLuint program = cache.Load(key)) {
+			ReplaceProgram(program);
+			float milliseconds = (float)timer.ElapsedMillis();
+			cache.RecordHit(milliseconds);
+			HZ_CORE_TRACE("Shader '{0}' {1:016x}: loaded from the cache in {2:.3f} ms", m_Name, key, milliseconds);
+			return;
+		}
+
+		// Nothing below waits for the compiler: the status of the compile and the link is only asked for in FinishCompile(). With parallel
+		// compilation, the driver works on them on its own threads in the meantime, else it usually does the work right there.
+		m_Pending = std::make_unique<PendingCompile>();
+		m_Pending->CacheKey = key;
+		m_Pending->Started = timer;
+		
+		// Creates an empty vertex shader handle
+		GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+
+		// Send the vertex shader source to GL
+		// Note that std::string's .c_str() is NULL character terminated
+		const GLchar* source = vertexSrc.c_str();
+		glShaderSource(vertexShader, 1, &source, 0);
+
+		// Compile the vertex shader
+		glCompileShader(vertexShader);
+
+		// Create an empty fragment shader handle
+		GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+
+		// Send the fragment shader source code to GL
+		// Note that std::string's .c_str() is NULL character terminated.
+		source = fragmentSrc.c_str();
+		glShaderSource(fragmentShader, 1, &source, 0);
+
+		// Compile the fragment shader
+		glCompileShader(fragmentShader);
+
+		// Get a program object, and link the shaders into it straight away. Linking shaders that failed to compile fails too, which
+		// FinishCompile() sorts out. On a reload, m_RendererID stays the old program until then.
+		GLuint program = glCreateProgram();
+
+		// Attach our shaders to our program
+		glAttachShader(program, vertexShader);
+		glAttachShader(program, fragmentShader);
+
+		// Has to be set before linking, for glGetProgramBinary() to work afterwards.
+		if (cache.IsSupported())
+			glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+		// Link our program
+		glLinkProgram(program);
+
+		m_Pending->Program = program;
+		m_Pending->VertexShader = vertexShader;
+		m_Pending->FragmentShader = fragmentShader;
+	}
+
+	void OpenGLShader::PollCompile(CompileStatus& status, uint32_t program) {
+
+		// FinishCompile() may have got there first, and deleted the program if it failed.
+		if (!status.Done.load(std::memory_order_relaxed)) {
+
+			// Without the extension there's no asking without waiting, so the render thread waits for the link, not IsReady()'s caller.
+			GLint completed = GL_TRUE;
+			if (s_ParallelCompile)
+				glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completed);
+			else {
+				GLint isLinked = 0;
+				glGetProgramiv(program, GL_LINK_STATUS, &isLinked); // linked or not, it's done after this
+			}
+
+			if (completed == GL_TRUE)
+				status.Done.store(true, std::memory_order_release);
+		}
+		status.PollQueued.store(false, std::memory_order_release);
+	}
+
+	// Logs the info log of a shader that failed to compile, or of the program if shader is 0.
+	static void LogInfoLog(GLuint program, GLuint shader) {
+
+		GLint maxLength = 0;
+		if (shader)
+			glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+		else
+			glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+		// The maxLength includes the NULL character
+		std::vector<GLchar> infoLog(maxLength + 1);
+		if (shader)
+			glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
+		else
+			glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
+
+		HZ_CORE_ERROR("{0}", infoLog.data());
+	}
+
+	void OpenGLShader::FinishCompile() const {
+
+		if (!m_Pending)
+			return;
+
+		HZ_PROFILE_FUNCTION();
+
+		std::unique_ptr<PendingCompile> pending = std::move(m_Pending);
+		pending->Status->Done.store(true, std::memory_order_release);
+		GLuint program = pending->Program;
+		GLuint vertexShader = pending->VertexShader;
+		GLuint fragmentShader = pending->FragmentShader;
+
+		// Where the wait for the compiler happens, if it hasn't finished yet.
+		GLint isCompiled = 0;
+		glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &isCompiled);
+		const char* failure = nullptr;
+		if (isCompiled == GL_FALSE) {
+			LogInfoLog(program, vertexShader);
+			failure = "Vertex Shader compilation failure!";
+		}
+		else {
+			glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &isCompiled);
+			if (isCompiled == GL_FALSE) {
+				LogInfoLog(program, fragmentShader);
+				failure = "Fragment shader compilation failure!";
+			}
+		}
+
+		// Note the different functions here: glGetProgram* instead of glGetShader*.
+		if (!failure) {
+			GLint isLinked = 0;
+			glGetProgramiv(program, GL_LINK_STATUS, (int*)&isLinked);
+			if (isLinked == GL_FALSE) {
+				LogInfoLog(program, 0);
+				failure = "Shader link failure!";
+			}
+		}
+
+		// Always detach shaders after a link, and don't leak them.
+		glDetachShader(program, vertexShader);
+		glDetachShader(program, fragmentShader);
+		glDeleteShader(vertexShader);
+		glDeleteShader(fragmentShader);
+
+		if (failure) {
+			// We don't need the program anymore. The first time round, binding 0 instead draws nothing, rather than crashing. A failed
+			// reload keeps the program that worked, there's no need to stop for a typo in a shader that's being edited.
+			glDeleteProgram(program);
+			if (m_RendererID) {
+				HZ_CORE_ERROR("Shader '{0}': {1} Keeping the previous version.", m_Name, failure);
+				return;
+			}
+			HZ_CORE_ASSERT(false, failure);
+			return;
+		}
+
+		ReplaceProgram(program);
+
+		OpenGLShaderCache& cache = OpenGLShaderCache::Get();
+		cache.Store(program, pending->CacheKey);
+		float milliseconds = (float)pending->Started.ElapsedMillis();
+		cache.RecordCompile(milliseconds);
+		HZ_CORE_TRACE("Shader '{0}' {1:016x}: compiled from source in {2:.3f} ms", m_Name, pending->CacheKey, milliseconds);
+	}
+
+	void OpenGLShader::ReplaceProgram(uint32_t program) const {
+
+		// Frames already recorded may still use the old one. (DeleteRetiredProgram())
+		HZ_CORE_ASSERT(!m_RetiredProgram, "The previous reload's program hasn't been deleted yet!");
+		m_RetiredProgram = m_RendererID;
+		m_RendererID = program;
+
+		// Every active uniform, once, rather than a glGetUniformLocation() per Set*(). Arrays are reported as "name[0]", and are set
+		// by their plain name. Names Set*() asked for that this version doesn't have are warned about again.
+		m_UniformLocations.clear();
+		GLint uniformCount = 0, maxLength = 0;
+		glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniformCount);
+		glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+		std::vector<GLchar> buffer(maxLength + 1);
+		for (GLint i = 0; i < uniformCount; i++) {
+
+			GLsizei length = 0;
+			GLint size = 0;
+			GLenum type = 0;
+			glGetActiveUniform(program, (GLuint)i, (GLsizei)buffer.size(), &length, &size, &type, buffer.data());
+
+			std::string name(buffer.data(), length);
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+				name.resize(name.size() - 3);
+
+			// Uniform block members have no location, they aren't set with glUniform*().
+			GLint location = glGetUniformLocation(program, buffer.data());
+			if (location != -1)
+				m_UniformLocations[name] = location;
+		}
+
+		// A new program starts with every uniform at 0, a reload's gets what the previous one was set to, (eg. the sampler array
+		// that's only set once) for the names it still has. Runs while the calling thread waits, (SubmitAndWait()) like the above.
+		for (const auto& [name, value] : m_UniformValues) {
+			auto it = m_UniformLocations.find(name);
+			if (it != m_UniformLocations.end())
+				UploadUniform(program, it->second, value.Type, value.Data.data(), value.Count);
+		}
+	}
+
+	void OpenGLShader::DeleteRetiredProgram() const {
+
+		if (!m_RetiredProgram)
+			return;
+
+		// Behind everything recorded so far, which is the last of what could use it.
+		RenderThread::Get().Submit([rendererID = m_RetiredProgram]() {
+			OpenGLStateCache::Get().OnDeleteProgram(rendererID);
+			glDeleteProgram(rendererID);
+		});
+		m_RetiredProgram = 0;
+	}
+
+	int OpenGLShader::GetUniformLocation(const std::string& name) const {
+
+		auto it = m_UniformLocations.find(name);
+		if (it != m_UniformLocations.end())
+			return it->second;
+
+		HZ_CORE_WARN("Shader '{0}': no active uniform '{1}'", m_Name, name);
+		m_UniformLocations[name] = -1;
+		return -1;
+	}
+
+	bool OpenGLShader::IsReady() const {
+
+		if (!m_Pending)
+			return true;
+
+		// Never waits: it's whatever the last poll found, and the next one goes behind what's been recorded so far. The compile is
+		// only finished, (logged and cached) by the first Bind() or Set*(), which by then doesn't wait either.
+		CompileStatus& status = *m_Pending->Status;
+		if (!status.Done.load(std::memory_order_acquire) && !status.PollQueued.exchange(true, std::memory_order_acq_rel)) {
+			RenderThread::Get().Submit([status = m_Pending->Status, program = m_Pending->Program]() {
+				PollCompile(*status, program);
+			});
+		}
+		return status.Done.load(std::memory_order_acquire);
+	}
+
+	void OpenGLShader::WaitUntilReady() const {
+
+		if (!m_Pending)
+			return;
+
+		RenderThread::Get().SubmitAndWait([this]() { FinishCompile(); });
+		DeleteRetiredProgram();
+	}
+
+	OpenGLShader::~OpenGLShader() {
+
+		// Still compiling, the pending program and its shaders go too. (after the program, which they're attached to, it doesn't matter)
+		uint32_t program = m_Pending ? m_Pending->Program : 0;
+		uint32_t vertexShader = m_Pending ? m_Pending->VertexShader : 0;
+		uint32_t fragmentShader = m_Pending ? m_Pending->FragmentShader : 0;
+
+		RenderThread::Get().Submit([rendererID = m_RendererID, program, vertexShader, fragmentShader]() {
+			OpenGLStateCache::Get().OnDeleteProgram(rendererID);
+			glDeleteProgram(rendererID);
+			if (program) {
+				glDeleteProgram(program);
+				glDeleteShader(vertexShader);
+				glDeleteShader(fragmentShader);
+			}
+		});
+	}
+
+	void OpenGLShader::Bind() const {
+
+		WaitUntilReady();
+		RenderThread::Get().Submit([rendererID = m_RendererID]() { OpenGLStateCache::Get().UseProgram(rendererID); });
+	}
+
+	void OpenGLShader::Unbind() const {
+		RenderThread::Get().Submit([]() { OpenGLStateCache::Get().UseProgram(0); });
+	}
+
+	uint32_t OpenGLShader::GetUniformTypeSize(UniformType type) {
+
+		switch (type) {
+			case UniformType::Int:		return sizeof(int);
+			case UniformType::Float:	return sizeof(float);
+			case UniformType::Float2:	return sizeof(float) * 2;
+			case UniformType::Float3:	return sizeof(float) * 3;
+			case UniformType::Float4:	return sizeof(float) * 4;
+			case UniformType::Mat4:		return sizeof(float) * 16;
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown UniformType!");
+		return 0;
+	}
+
+	void OpenGLShader::UploadUniform(uint32_t program, int location, UniformType type, const void* data, uint32_t count) {
+
+		// glUniform*() only reaches the bound program, so this one is bound for it, and whichever was bound before is put back.
+		if (!GLAD_GL_VERSION_4_1) {
+			OpenGLStateCache& stateCache = OpenGLStateCache::Get();
+			uint32_t previous = stateCache.GetProgram();
+			stateCache.UseProgram(program);
+			switch (type) {
+				case UniformType::Int:		glUniform1iv(location, count, (const GLint*)data); break;
+				case UniformType::Float:	glUniform1fv(location, count, (const GLfloat*)data); break;
+				case UniformType::Float2:	glUniform2fv(location, count, (const GLfloat*)data); break;
+				case UniformType::Float3:	glUniform3fv(location, count, (const GLfloat*)data); break;
+				case UniformType::Float4:	glUniform4fv(location, count, (const GLfloat*)data); break;
+				case UniformType::Mat4:		glUniformMatrix4fv(location, count, GL_FALSE, (const GLfloat*)data); break;
+			}
+			stateCache.UseProgram(previous);
+			return;
+		}
+
+		switch (type) {
+			case UniformType::Int:		glProgramUniform1iv(program, location, count, (const GLint*)data); return;
+			case UniformType::Float:	glProgramUniform1fv(program, location, count, (const GLfloat*)data); return;
+			case UniformType::Float2:	glProgramUniform2fv(program, location, count, (const GLfloat*)data); return;
+			case UniformType::Float3:	glProgramUniform3fv(program, location, count, (const GLfloat*)data); return;
+			case UniformType::Float4:	glProgramUniform4fv(program, location, count, (const GLfloat*)data); return;
+			case UniformType::Mat4:		glProgramUniformMatrix4fv(program, location, count, GL_FALSE, (const GLfloat*)data); return;
+		}
+	}
+
+	void OpenGLShader::SetUniform(const std::string& name, UniformType type, const void* data, uint32_t count) {
+
+		WaitUntilReady();
+
+		// Even for names the program doesn't have, the next version of it may.
+		uint32_t size = count * GetUniformTypeSize(type);
+		UniformValue& value = m_UniformValues[name];
+		value.Type = type;
+		value.Count = count;
+		value.Data.assign((const uint8_t*)data, (const uint8_t*)data + size);
+
+		int location = GetUniformLocation(name);
+		if (location == -1)
+			return;
+
+		const void* copy = RenderThread::Get().Copy(data, size);
+		RenderThread::Get().Submit([rendererID = m_RendererID, location, type, copy, count]() {
+			UploadUniform(rendererID, location, type, copy, count);
+		});
+	}
+
+	void OpenGLShader::SetInt(const std::string& name, int value) {
+		SetUniform(name, UniformType::Int, &value, 1);
+	}
+
+	void OpenGLShader::SetIntArray(const std::string& name, const int* values, uint32_t count) {
+		SetUniform(name, UniformType::Int, values, count);
+	}
+
+	void OpenGLShader::SetFloat(const std::string& name, float value) {
+		SetUniform(name, UniformType::Float, &value, 1);
+	}
+
+	void OpenGLShader::SetFloat2(const std::string& name, const glm::vec2& value) {
+		SetUniform(name, UniformType::Float2, glm::value_ptr(value), 1);
+	}
+
+	void OpenGLShader::SetFloat3(const std::string& name, const glm::vec3& value) {
+		SetUniform(name, UniformType::Float3, glm::value_ptr(value), 1);
+	}
+
+	void OpenGLShader::SetFloat4(const std::string& name, const glm::vec4& value) {
+		SetUniform(name, UniformType::Float4, glm::value_ptr(value), 1);
+	}
+
+	void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& value) {
+		SetUniform(name, UniformType::Mat4, glm::value_ptr(value), 1);
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Hazel/Renderer/Shader.h"
+#include "Hazel/Timer.h"
+
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Hazel {
+
+	class OpenGLShader : public Shader {
+	// The constructor only starts compiling and linking, (or loads the program from the OpenGLShaderCache) it never waits for the
+	// driver's compiler. The first Bind() or Set*() does, if the compile hasn't finished by then. IsReady() never waits, it reads a flag
+	// the render thread sets, and queues a poll for the next time round. With GL_KHR_parallel_shader_compile, the poll asks the driver
+	// whether it's done, without waiting. Without it, it can't be asked, and the render thread waits for the link instead of the caller.
+	// Once linked, every active uniform's location is looked up, (glGetActiveUniform()) so that Set*() is a hash lookup on the calling
+	// thread, and the render thread only ever gets the program, the location and the value. (glProgramUniform*(), it doesn't matter
+	// which program is bound) Set*() remembers the values too, a reload's program gets them all as soon as it's linked.
+	public:
+
+		OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+		virtual ~OpenGLShader();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual void SetInt(const std::string& name, int value) override;
+		virtual void SetIntArray(const std::string& name, const int* values, uint32_t count) override;
+		virtual void SetFloat(const std::string& name, float value) override;
+		virtual void SetFloat2(const std::string& name, const glm::vec2& value) override;
+		virtual void SetFloat3(const std::string& name, const glm::vec3& value) override;
+		virtual void SetFloat4(const std::string& name, const glm::vec4& value) override;
+		virtual void SetMat4(const std::string& name, const glm::mat4& value) override;
+
+		inline virtual const std::string& GetName() const override { return m_Name; }
+
+		virtual bool IsReady() const override;
+		virtual void WaitUntilReady() const override;
+
+		virtual void Reload(const std::string& vertexSrc, const std::string& fragmentSrc) override;
+
+		// Looks for the extension, and lets the driver use as many compiler threads as it wants. Needs the OpenGL context to be current.
+		static void InitParallelCompile();
+		inline static bool IsParallelCompileSupported() { return s_ParallelCompile; }
+
+	private:
+
+		// On the thread that owns the context.
+		void StartCompile(const std::string& vertexSrc, const std::string& fragmentSrc);
+		void FinishCompile() const; // checks (and so waits for) the compile and link, logs the errors, stores the binary
+		void ReplaceProgram(uint32_t program) const; // makes a linked program the current one, and reflects its uniforms
+
+		enum class UniformType : uint8_t { Int, Float, Float2, Float3, Float4, Mat4 };
+
+		struct UniformValue {
+
+			UniformType Type = UniformType::Int;
+			uint32_t Count = 0; // of that type, more than 1 for arrays
+			std::vector<uint8_t> Data;
+		};
+
+		static uint32_t GetUniformTypeSize(UniformType type);
+
+		// Remembers the value, and sets it on the current program.
+		void SetUniform(const std::string& name, UniformType type, const void* data, uint32_t count);
+		// On the render thread: glProgramUniform*(), or where that's missing (before OpenGL 4.1) binds the program for glUniform*(), and
+		// rebinds the one that was bound.
+		static void UploadUniform(uint32_t program, int location, UniformType type, const void* data, uint32_t count);
+
+		// On the calling thread, after a SubmitAndWait(): the program a reload replaced can only go once it's off the render thread.
+		void DeleteRetiredProgram() const;
+		// -1 for names the program doesn't have, which glUniform*() ignores. Warns about each of those once.
+		int GetUniformLocation(const std::string& name) const;
+
+	private:
+
+		// Shared with the polls queued on the render thread, which may still run after the compile has finished, or the shader is gone.
+		struct CompileStatus {
+
+			std::atomic<bool> Done{ false };		// nothing left to wait for, set by a poll or FinishCompile()
+			std::atomic<bool> PollQueued{ false };	// so that IsReady() in a loop doesn't queue one per call
+		};
+
+		struct PendingCompile {
+
+			uint32_t Program = 0, VertexShader = 0, FragmentShader = 0;
+			uint64_t CacheKey = 0;
+			Timer Started; // since StartCompile()
+			std::shared_ptr<CompileStatus> Status = std::make_shared<CompileStatus>();
+		};
+
+		// On the render thread, from IsReady().
+		static void PollCompile(CompileStatus& status, uint32_t program);
+
+		std::string m_Name;
+
+		// These only change in FinishCompile(), which is called from const methods, since that's where the first use happens.
+		mutable uint32_t m_RendererID = 0; // 0 when the first compile or link failed
+		mutable uint32_t m_RetiredProgram = 0; // the one a successful reload replaced, until DeleteRetiredProgram()
+		mutable std::unique_ptr<PendingCompile> m_Pending; // null once the compile has finished
+		mutable std::unordered_map<std::string, int> m_UniformLocations;
+		std::unordered_map<std::string, UniformValue> m_UniformValues; // everything Set*() so far, by name
+
+		static bool s_ParallelCompile;
+	};
+}
@@ -0,0 +1,213 @@
+#include "hzpch.h"
+#include "OpenGLShaderCache.h"
+
+#include <glad/glad.h>
+
+#include <filesystem>
+#include <fstream>
+
+
+namespace Hazel {
+
+	// In front of every binary on disk.
+	struct ProgramBinaryHeader {
+
+		static constexpr uint32_t CurrentMagic = 0x42505a48; // "HZPB"
+		static constexpr uint32_t CurrentVersion = 1;
+
+		uint32_t Magic = CurrentMagic;
+		uint32_t Version = CurrentVersion;
+		uint64_t Key = 0;		// the one in the file name, in case it was renamed
+		uint32_t Format = 0;	// as returned by glGetProgramBinary
+		uint32_t Size = 0;		// of the binary that follows
+	};
+
+	std::string OpenGLShaderCache::s_Directory = "cache/shaders";
+	bool OpenGLShaderCache::s_Enabled = true;
+
+	OpenGLShaderCache& OpenGLShaderCache::Get() {
+
+		static OpenGLShaderCache instance;
+		return instance;
+	}
+
+	void OpenGLShaderCache::SetDirectory(const std::string& directory) {
+		s_Directory = directory;
+	}
+
+	void OpenGLShaderCache::SetEnabled(bool enabled) {
+		s_Enabled = enabled;
+	}
+
+	void OpenGLShaderCache::Init() {
+
+		GLint formats = 0;
+		if (GLAD_GL_VERSION_4_1 && glProgramBinary && glGetProgramBinary)
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+		m_Supported = formats > 0;
+		if (!m_Supported) {
+			HZ_CORE_WARN("OpenGL program binaries are not available, every shader is compiled from source.");
+			return;
+		}
+
+		m_Driver.clear();
+		for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+			const char* value = (const char*)glGetString(name);
+			m_Driver += value ? value : "";
+			m_Driver += '\n';
+		}
+	}
+
+	uint64_t OpenGLShaderCache::GetKey(std::initializer_list<std::string_view> sources) const {
+
+		// FNV-1a, over every source and then the driver. Each one is followed by a 0, so moving text from one source to the next
+		// still changes the key.
+		uint64_t hash = 14695981039346656037ull;
+		auto add = [&hash](std::string_view text) {
+			for (char c : text) {
+				hash ^= (uint8_t)c;
+				hash *= 1099511628211ull;
+			}
+			hash *= 1099511628211ull; // the 0
+		};
+
+		for (std::string_view source : sources)
+			add(source);
+		add(m_Driver);
+
+		return hash;
+	}
+
+	std::string OpenGLShaderCache::GetPath(uint64_t key) const {
+
+		char name[32];
+		snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+		return (std::filesystem::path(s_Directory) / name).string();
+	}
+
+	uint32_t OpenGLShaderCache::Load(uint64_t key) {
+
+		if (!IsSupported())
+			return 0;
+
+		HZ_PROFILE_FUNCTION();
+
+		std::string path = GetPath(key);
+		std::ifstream in(path, std::ios::binary);
+		if (!in)
+			return 0;
+
+		ProgramBinaryHeader header;
+		in.read((char*)&header, sizeof(header));
+		bool valid = in && header.Magic == ProgramBinaryHeader::CurrentMagic && header.Version == ProgramBinaryHeader::CurrentVersion
+			&& header.Key == key && header.Size > 0;
+
+		std::vector<uint8_t> binary;
+		if (valid) {
+			binary.resize(header.Size);
+			in.read((char*)binary.data(), header.Size);
+			valid = (bool)in;
+		}
+		in.close();
+
+		GLuint program = 0;
+		if (valid) {
+
+			program = glCreateProgram();
+			glProgramBinary(program, header.Format, binary.data(), (GLsizei)binary.size());
+
+			GLint isLinked = GL_FALSE;
+			glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+			if (isLinked == GL_FALSE) {
+				glDeleteProgram(program);
+				program = 0;
+			}
+		}
+
+		// A file that's truncated, from an older version, or that the driver doesn't want anymore. Removed, so it gets stored again
+		// after the compile.
+		if (!program) {
+
+			HZ_CORE_WARN("Shader cache: binary {0} rejected, compiling from source.", path);
+			std::error_code error;
+			std::filesystem::remove(path, error);
+
+			std::lock_guard<std::mutex> lock(m_StatsMutex);
+			m_Stats.Rejected++;
+		}
+
+		return program;
+	}
+
+	void OpenGLShaderCache::Store(uint32_t program, uint64_t key) {
+
+		if (!IsSupported())
+			return;
+
+		HZ_PROFILE_FUNCTION();
+
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0)
+			return;
+
+		ProgramBinaryHeader header;
+		header.Key = key;
+
+		std::vector<uint8_t> binary(length);
+		GLenum format = 0;
+		glGetProgramBinary(program, length, &length, &format, binary.data());
+		header.Format = format;
+		header.Size = (uint32_t)length;
+
+		std::error_code error;
+		std::filesystem::create_directories(s_Directory, error);
+
+		// Written next to it and renamed, so another instance starting up at the same time never reads half a file.
+		std::string path = GetPath(key);
+		std::string temporaryPath = path + ".tmp";
+		{
+			std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+			out.write((const char*)&header, sizeof(header));
+			out.write((const char*)binary.data(), header.Size);
+			if (!out) {
+				HZ_CORE_WARN("Shader cache: couldn't write {0}", temporaryPath);
+				return;
+			}
+		}
+
+		std::filesystem::rename(temporaryPath, path, error);
+		if (error) {
+			HZ_CORE_WARN("Shader cache: couldn't write {0} ({1})", path, error.message());
+			std::filesystem::remove(temporaryPath, error);
+		}
+	}
+
+	void OpenGLShaderCache::RecordHit(float milliseconds) {
+
+		std::lock_guard<std::mutex> lock(m_StatsMutex);
+		m_Stats.Hits++;
+		m_Stats.HitMilliseconds += milliseconds;
+	}
+
+	void OpenGLShaderCache::RecordCompile(float milliseconds) {
+
+		std::lock_guard<std::mutex> lock(m_StatsMutex);
+		m_Stats.Misses++;
+		m_Stats.CompileMilliseconds += milliseconds;
+	}
+
+	OpenGLShaderCacheStats OpenGLShaderCache::GetStats() const {
+
+		std::lock_guard<std::mutex> lock(m_StatsMutex);
+		return m_Stats;
+	}
+
+	void OpenGLShaderCache::LogStats() const {
+
+		OpenGLShaderCacheStats stats = GetStats();
+		HZ_CORE_INFO("Shader cache: {0} program(s) loaded in {1:.1f} ms, {2} compiled from source in {3:.1f} ms, {4} binaries rejected",
+			stats.Hits, stats.HitMilliseconds, stats.Misses, stats.CompileMilliseconds, stats.Rejected);
+	}
+}
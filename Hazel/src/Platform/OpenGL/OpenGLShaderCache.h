@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Hazel/Core.h"
+
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+
+namespace Hazel {
+
+	struct OpenGLShaderCacheStats {
+
+		uint32_t Hits = 0;			// programs loaded from a binary
+		uint32_t Misses = 0;		// compiled from source, rejected ones included
+		uint32_t Rejected = 0;		// binaries the driver refused (updated driver, different GPU) or that were truncated
+		float HitMilliseconds = 0.0f;		// total spent loading binaries
+		float CompileMilliseconds = 0.0f;	// total spent compiling from source, storing the binary included
+	};
+
+
+	class OpenGLShaderCache {
+	// Linked programs saved to disk with glGetProgramBinary, and loaded back with glProgramBinary on the next launch, instead of
+	// compiling and linking the GLSL again. A binary is keyed by a hash of the program's sources, and of the driver's vendor, renderer and
+	// version strings, so editing a shader or changing driver gives it a new key. A driver can still refuse a binary it made itself, (the
+	// format is only valid for the exact same driver and hardware) in which case Load() returns 0 and the caller compiles from source,
+	// as if there were no binary. Needs GL 4.1, (our Glad is core only, so no ARB_get_program_binary)
+	// and at least one binary format, else it's a no-op.
+	// Used from the thread that owns the context. The stats can be read from any thread.
+	public:
+
+		OpenGLShaderCache(const OpenGLShaderCache&) = delete;
+		OpenGLShaderCache& operator=(const OpenGLShaderCache&) = delete;
+
+		// Needs the OpenGL context to be current, reads the driver strings that go into every key.
+		void Init();
+
+		inline bool IsSupported() const { return m_Supported && s_Enabled; }
+
+		uint64_t GetKey(std::initializer_list<std::string_view> sources) const;
+
+		// A linked program made from the binary stored under key, or 0 if there's none (or the driver rejected it).
+		uint32_t Load(uint64_t key);
+		// Saves the binary of a program that was just linked. It has to have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+		void Store(uint32_t program, uint64_t key);
+
+		// For the logs and the performance panel.
+		void RecordHit(float milliseconds);
+		void RecordCompile(float milliseconds);
+		OpenGLShaderCacheStats GetStats() const;
+		void LogStats() const;
+
+		static OpenGLShaderCache& Get();
+
+		// Where the binaries go, relative to the working directory. Has to be set before the first shader is created.
+		static void SetDirectory(const std::string& directory);
+		inline static const std::string& GetDirectory() { return s_Directory; }
+		// On by default, off compiles every shader from source. (eg. while working on the shader compiler's output)
+		static void SetEnabled(bool enabled);
+		inline static bool IsEnabled() { return s_Enabled; }
+
+	private:
+
+		OpenGLShaderCache() = default;
+
+		std::string GetPath(uint64_t key) const;
+
+	private:
+
+		bool m_Supported = false;
+		std::string m_Driver; // vendor, renderer and version strings
+
+		mutable std::mutex m_StatsMutex;
+		OpenGLShaderCacheStats m_Stats;
+
+		static std::string s_Directory;
+		static bool s_Enabled;
+	};
+}
@@ -0,0 +1,185 @@
+#include "hzpch.h"
+#include "OpenGLStateCache.h"
+
+#include <glad/glad.h>
+
+
+namespace Hazel {
+
+	OpenGLStateCache& OpenGLStateCache::Get() {
+
+		static OpenGLStateCache instance;
+		return instance;
+	}
+
+	void OpenGLStateCache::UseProgram(uint32_t program) {
+
+		if (Elide(m_Program == program))
+			return;
+
+		glUseProgram(program);
+		m_Program = program;
+	}
+
+	uint32_t OpenGLStateCache::GetProgram() {
+
+		if (m_Program == Unknown) {
+			GLint program = 0;
+			glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+			m_Program = (uint32_t)program;
+		}
+		return m_Program;
+	}
+
+	void OpenGLStateCache::BindVertexArray(uint32_t vertexArray) {
+
+		if (Elide(m_VertexArray == vertexArray))
+			return;
+
+		glBindVertexArray(vertexArray);
+		m_VertexArray = vertexArray;
+		m_ElementArrayBuffer = Unknown;
+	}
+
+	void OpenGLStateCache::BindBuffer(uint32_t target, uint32_t buffer) {
+
+		uint32_t* cached = nullptr;
+		if (target == GL_ARRAY_BUFFER)
+			cached = &m_ArrayBuffer;
+		else if (target == GL_ELEMENT_ARRAY_BUFFER)
+			cached = &m_ElementArrayBuffer;
+
+		if (cached && Elide(*cached == buffer))
+			return;
+
+		glBindBuffer(target, buffer);
+		if (cached)
+			*cached = buffer;
+		else
+			m_Stats.Issued++;
+	}
+
+	void OpenGLStateCache::BindTexture2D(uint32_t unit, uint32_t texture) {
+
+		if (unit >= MaxTextureUnits) {
+			m_Stats.Issued += 2;
+			glActiveTexture(GL_TEXTURE0 + unit);
+			glBindTexture(GL_TEXTURE_2D, texture);
+			m_ActiveTextureUnit = unit;
+			return;
+		}
+
+		if (Elide(m_Textures[unit] == texture))
+			return;
+
+		if (m_ActiveTextureUnit != unit) {
+			glActiveTexture(GL_TEXTURE0 + unit);
+			m_ActiveTextureUnit = unit;
+		}
+		glBindTexture(GL_TEXTURE_2D, texture);
+		m_Textures[unit] = texture;
+	}
+
+	void OpenGLStateCache::BindTexture2D(uint32_t texture) {
+
+		if (m_ActiveTextureUnit == Unknown) {
+			glActiveTexture(GL_TEXTURE0);
+			m_ActiveTextureUnit = 0;
+		}
+		BindTexture2D(m_ActiveTextureUnit, texture);
+	}
+
+	void OpenGLStateCache::SetCapability(uint32_t capability, int8_t& cached, bool enabled) {
+
+		if (Elide(cached == (int8_t)enabled))
+			return;
+
+		if (enabled)
+			glEnable(capability);
+		else
+			glDisable(capability);
+		cached = (int8_t)enabled;
+	}
+
+	void OpenGLStateCache::SetBlend(bool enabled) {
+		SetCapability(GL_BLEND, m_Blend, enabled);
+	}
+
+	void OpenGLStateCache::SetBlendFunc(uint32_t source, uint32_t destination) {
+
+		if (Elide(m_BlendSource == source && m_BlendDestination == destination))
+			return;
+
+		glBlendFunc(source, destination);
+		m_BlendSource = source;
+		m_BlendDestination = destination;
+	}
+
+	void OpenGLStateCache::SetDepthTest(bool enabled) {
+		SetCapability(GL_DEPTH_TEST, m_DepthTest, enabled);
+	}
+
+	void OpenGLStateCache::SetCullFace(bool enabled) {
+		SetCapability(GL_CULL_FACE, m_CullFace, enabled);
+	}
+
+	// GL unbinds a deleted object from the current context, so a name that gets reused afterwards mustn't look like it's still bound.
+	void OpenGLStateCache::OnDeleteProgram(uint32_t program) {
+
+		if (m_Program == program)
+			m_Program = 0;
+	}
+
+	void OpenGLStateCache::OnDeleteVertexArray(uint32_t vertexArray) {
+
+		if (m_VertexArray == vertexArray) {
+			m_VertexArray = 0;
+			m_ElementArrayBuffer = Unknown;
+		}
+	}
+
+	void OpenGLStateCache::OnDeleteBuffer(uint32_t buffer) {
+
+		if (m_ArrayBuffer == buffer)
+			m_ArrayBuffer = 0;
+		if (m_ElementArrayBuffer == buffer)
+			m_ElementArrayBuffer = 0;
+	}
+
+	void OpenGLStateCache::OnDeleteTexture(uint32_t texture) {
+
+		for (uint32_t& bound : m_Textures) {
+			if (bound == texture)
+				bound = 0;
+		}
+	}
+
+	void OpenGLStateCache::Invalidate() {
+
+		m_Program = Unknown;
+		m_VertexArray = Unknown;
+		m_ArrayBuffer = Unknown;
+		m_ElementArrayBuffer = Unknown;
+		m_ActiveTextureUnit = Unknown;
+		for (uint32_t& texture : m_Textures)
+			texture = Unknown;
+
+		m_Blend = m_DepthTest = m_CullFace = -1;
+		m_BlendSource = m_BlendDestination = Unknown;
+	}
+
+	void OpenGLStateCache::EndFrame() {
+
+		{
+			std::lock_guard<std::mutex> lock(m_LastFrameMutex);
+			m_LastFrameStats = m_Stats;
+		}
+		m_Stats = OpenGLStateCacheStats();
+	}
+
+	OpenGLStateCacheStats OpenGLStateCache::GetLastFrameStats() const {
+
+		std::lock_guard<std::mutex> lock(m_LastFrameMutex);
+		return m_LastFrameStats;
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Hazel/Core.h"
+
+#include <mutex>
+
+
+namespace Hazel {
+
+	struct OpenGLStateCacheStats {
+
+		uint64_t Issued = 0;	// calls that went through to GL
+		uint64_t Elided = 0;	// calls skipped, since they'd have set what was already set
+	};
+
+
+	class OpenGLStateCache {
+	// Mirror of the binds and capabilities of the OpenGL context, so that setting what's already set doesn't reach the driver. Every
+	// bind in Platform/OpenGL goes through here instead of calling GL directly. Anything that changes state behind its back (ImGui's
+	// backend, another library, raw GL calls) has to be followed by Invalidate(), after which every call goes through again until the 
+	// cache has caught up. Deleting an object that's bound unbinds it, the OnDelete*() hooks keep the cache in step with that.
+	// One context, used from the thread that owns it.
+	public:
+
+		static constexpr uint32_t MaxTextureUnits = 32;
+
+		OpenGLStateCache(const OpenGLStateCache&) = delete;
+		OpenGLStateCache& operator=(const OpenGLStateCache&) = delete;
+
+		void UseProgram(uint32_t program);
+		// The bound program, asked from GL if the cache doesn't know it. (after Invalidate())
+		uint32_t GetProgram();
+		void BindVertexArray(uint32_t vertexArray);
+		// GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER, anything else goes straight through. (the element buffer is part of the bound
+		// vertex array's state, so it's forgotten whenever the vertex array changes)
+		void BindBuffer(uint32_t target, uint32_t buffer);
+		void BindTexture2D(uint32_t unit, uint32_t texture);
+		// Binds to whichever unit is active, for uploads. (where the unit doesn't matter)
+		void BindTexture2D(uint32_t texture);
+
+		void SetBlend(bool enabled);
+		void SetBlendFunc(uint32_t source, uint32_t destination);
+		void SetDepthTest(bool enabled);
+		void SetCullFace(bool enabled);
+
+		void OnDeleteProgram(uint32_t program);
+		void OnDeleteVertexArray(uint32_t vertexArray);
+		void OnDeleteBuffer(uint32_t buffer);
+		void OnDeleteTexture(uint32_t texture);
+
+		// Forgets everything, the next call of each kind is issued no matter what.
+		void Invalidate();
+
+		// Totals since the last EndFrame(), from the thread using the context. The last frame's can be read from any thread. (eg. the
+		// performance panel, while the RenderThread runs the context)
+		inline const OpenGLStateCacheStats& GetStats() const { return m_Stats; }
+		OpenGLStateCacheStats GetLastFrameStats() const;
+		void EndFrame(); // (called by OpenGLContext::SwapBuffers())
+
+		static OpenGLStateCache& Get();
+
+	private:
+
+		OpenGLStateCache() { Invalidate(); }
+
+		void SetCapability(uint32_t capability, int8_t& cached, bool enabled);
+
+		inline bool Elide(bool same) {
+			if (same)
+				m_Stats.Elided++;
+			else
+				m_Stats.Issued++;
+			return same;
+		}
+
+	private:
+
+		static constexpr uint32_t Unknown = 0xffffffff;
+
+		uint32_t m_Program;
+		uint32_t m_VertexArray;
+		uint32_t m_ArrayBuffer;
+		uint32_t m_ElementArrayBuffer;
+		uint32_t m_ActiveTextureUnit;
+		uint32_t m_Textures[MaxTextureUnits];
+
+		// -1 unknown, 0 disabled, 1 enabled
+		int8_t m_Blend, m_DepthTest, m_CullFace;
+		uint32_t m_BlendSource, m_BlendDestination;
+
+		OpenGLStateCacheStats m_Stats;
+		OpenGLStateCacheStats m_LastFrameStats;
+		mutable std::mutex m_LastFrameMutex;
+	};
+}
@@ -0,0 +1,50 @@
+#include "hzpch.h"
+#include "OpenGLTexture.h"
+
+#include "OpenGLStateCache.h"
+
+#include "Hazel/Renderer/RenderThread.h"
+
+#include <glad/glad.h>
+
+
+namespace Hazel {
+
+	OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height)
+		: m_Width(width), m_Height(height)
+	{
+		RenderThread::Get().SubmitAndWait([&]() {
+			glGenTextures(1, &m_RendererID);
+			OpenGLStateCache::Get().BindTexture2D(m_RendererID);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_Width, m_Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		});
+	}
+
+	OpenGLTexture2D::~OpenGLTexture2D() {
+
+		RenderThread::Get().Submit([rendererID = m_RendererID]() {
+			OpenGLStateCache::Get().OnDeleteTexture(rendererID);
+			glDeleteTextures(1, &rendererID);
+		});
+	}
+
+	void OpenGLTexture2D::SetData(const void* data, uint32_t size) {
+
+		HZ_CORE_ASSERT(size == m_Width * m_Height * 4, "Data must be the entire texture!");
+
+		const void* copy = RenderThread::Get().Copy(data, size);
+		RenderThread::Get().Submit([rendererID = m_RendererID, width = m_Width, height = m_Height, copy]() {
+			OpenGLStateCache::Get().BindTexture2D(rendererID);
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, copy);
+		});
+	}
+
+	void OpenGLTexture2D::Bind(uint32_t slot) const {
+		RenderThread::Get().Submit([rendererID = m_RendererID, slot]() { OpenGLStateCache::Get().BindTexture2D(slot, rendererID); });
+	}
+}
@@ -0,0 +1,114 @@
+#include "hzpch.h"
+#include "OpenGLVertexArray.h"
+
+#include "OpenGLStateCache.h"
+
+#include "Hazel/Renderer/RenderThread.h"
+
+#include <glad/glad.h>
+
+
+namespace Hazel {
+
+	static GLenum ShaderDataTypeToOpenGLBaseType(ShaderDataType type) {
+
+		switch (type) {
+
+			case ShaderDataType::Float:		return GL_FLOAT;
+			case ShaderDataType::Float2:	return GL_FLOAT;
+			case ShaderDataType::Float3:	return GL_FLOAT;
+			case ShaderDataType::Float4:	return GL_FLOAT;
+			case ShaderDataType::Mat3:		return GL_FLOAT;
+			case ShaderDataType::Mat4:		return GL_FLOAT;
+			case ShaderDataType::Int:		return GL_INT;
+			case ShaderDataType::Int2:		return GL_INT;
+			case ShaderDataType::Int3:		return GL_INT;
+			case ShaderDataType::Int4:		return GL_INT;
+			case ShaderDataType::Bool:		return GL_UNSIGNED_BYTE; // one byte, (see ShaderDataTypeSize) GL_BOOL isn't a vertex type
+			default:						break;
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown ShaderDataType!");
+		return 0;
+	}
+
+	OpenGLVertexArray::OpenGLVertexArray() {
+		RenderThread::Get().SubmitAndWait([&]() { glGenVertexArrays(1, &m_RendererID); });
+	}
+
+	OpenGLVertexArray::~OpenGLVertexArray() {
+
+		RenderThread::Get().Submit([rendererID = m_RendererID]() {
+			OpenGLStateCache::Get().OnDeleteVertexArray(rendererID);
+			glDeleteVertexArrays(1, &rendererID);
+		});
+	}
+
+	void OpenGLVertexArray::Bind() const {
+		RenderThread::Get().Submit([rendererID = m_RendererID]() { OpenGLStateCache::Get().BindVertexArray(rendererID); });
+	}
+
+	void OpenGLVertexArray::Unbind() const {
+		RenderThread::Get().Submit([]() { OpenGLStateCache::Get().BindVertexArray(0); });
+	}
+
+	void OpenGLVertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) {
+
+		HZ_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+
+		Bind();
+		vertexBuffer->Bind();
+
+		// The attributes are numbered here, and the layout copied into the command, so nothing of the buffer is read when it runs.
+		uint32_t firstAttrib = m_VertexAttribIndex;
+		for (const BufferElement& element : vertexBuffer->GetLayout())
+			m_VertexAttribIndex += element.Type == ShaderDataType::Mat3 ? 3 : element.Type == ShaderDataType::Mat4 ? 4 : 1;
+
+		RenderThread::Get().Submit([layout = vertexBuffer->GetLayout(), firstAttrib]() {
+
+			uint32_t attrib = firstAttrib;
+			for (const BufferElement& element : layout) {
+
+				GLenum baseType = ShaderDataTypeToOpenGLBaseType(element.Type);
+
+				// An attribute is 4 components at most, so matrices take one attribute (location) per column.
+				uint32_t columns = 1;
+				if (element.Type == ShaderDataType::Mat3)
+					columns = 3;
+				else if (element.Type == ShaderDataType::Mat4)
+					columns = 4;
+				uint32_t components = element.GetComponentCount() / columns;
+
+				for (uint32_t column = 0; column < columns; column++) {
+
+					const void* offset = (const void*)(uintptr_t)(element.Offset + column * components * sizeof(float));
+					glEnableVertexAttribArray(attrib);
+
+					// Integer attributes, (Bool included) need the I variant, else they get converted to floats on the way in.
+					if (baseType == GL_INT || baseType == GL_UNSIGNED_BYTE) {
+						glVertexAttribIPointer(attrib, components, baseType, layout.GetStride(), offset);
+					}
+					else {
+						glVertexAttribPointer(attrib, components, baseType, element.Normalized ? GL_TRUE : GL_FALSE,
+							layout.GetStride(), offset);
+					}
+
+					if (layout.IsPerInstance())
+						glVertexAttribDivisor(attrib, layout.GetDivisor());
+
+					attrib++;
+				}
+			}
+		});
+
+		m_VertexBuffers.push_back(vertexBuffer);
+	}
+
+	void OpenGLVertexArray::SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) {
+
+		Bind();
+		indexBuffer->Bind();
+
+		m_IndexBuffer = indexBuffer;
+	}
+}
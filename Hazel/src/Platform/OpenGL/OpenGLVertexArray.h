@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Hazel/Renderer/VertexArray.h"
+
+
+namespace Hazel {
+
+	class OpenGLVertexArray : public VertexArray {
+
+	public:
+
+		OpenGLVertexArray();
+		virtual ~OpenGLVertexArray();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) override;
+		virtual void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) override;
+
+		inline virtual const std::vector<std::shared_ptr<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+		inline virtual const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+	private:
+
+		uint32_t m_RendererID;
+		uint32_t m_VertexAttribIndex = 0;
+		std::vector<std::shared_ptr<VertexBuffer>> m_VertexBuffers;
+		std::shared_ptr<IndexBuffer> m_IndexBuffer;
+	};
+}
@@ -1,9 +1,7 @@
 #include "hzpch.h"
 #include "WindowsWindow.h"
 
-#include "Hazel/Events/ApplicationEvent.h"
-#include "Hazel/Events/MouseEvent.h"
-#include "Hazel/Events/KeyEvent.h"
+#include "Hazel/Renderer/RenderThread.h"
 
 #include "Platform/OpenGL/OpenGLContext.h"
 
@@ -33,9 +31,12 @@ namespace Hazel {
 
 	void WindowsWindow::Init(const WindowProps& props) {
 
+		HZ_PROFILE_FUNCTION();
+
 		m_Data.Title = props.Title;
 		m_Data.Width = props.Width;
 		m_Data.Height = props.Height;
+		m_Data.Headless = props.Headless;
 
 		HZ_CORE_INFO("Creating window {0} ({1}, {2})", props.Title, props.Width, props.Height);
 		
@@ -49,6 +50,9 @@ namespace Hazel {
 			s_GLFWInitialized = true;
 		}
 
+		// There's always a desktop on Windows, so headless is just a hidden window. (the Linux backend can go without a display at all)
+		glfwWindowHint(GLFW_VISIBLE, props.Headless ? GLFW_FALSE : GLFW_TRUE);
+
 		//Creates a new GLFW window
 		m_Window = glfwCreateWindow((int)props.Width, (int)props.Height, m_Data.Title.c_str(), nullptr, nullptr);
 
@@ -58,111 +62,15 @@ namespace Hazel {
 
 		
 
-		// The purpose of UserPointer: allows you to associate a pointer to any user-defined data with the window. This can be a pointer to a 
-		// class, a structure, or any other type of data you want to associate with that window.
-		glfwSetWindowUserPointer(m_Window, &m_Data); // passing the struct "WindowData"
 		SetVSync(true);
 
-
-
-
-		// ---------------------------------------------------------------------can delete up to here.----------------------------------------------------------------------------
-
-		// ---------------------------------------------------------------------------------------------------
-		// Setting GLFW Callbacks 
-		// callbacks for various window events are set using lambda functions that capture the WindowData context and create the appropriate event, invoking EventCallback.
-		/*
-		-- m_Window is passed into glfwSetCharCallback(as an example) as which handle will it set this CharCallback to. 
-		-- This lambda function, or cbfun, will then be a pointer that is set to the m_Window class. (note: m_Window is a GLFWwindow object).
-		-- So from now on, whenever a specific event is detected, this lambda function will be called by the GLFWwindow object. 
-		*/
-		glfwSetWindowSizeCallback(m_Window, [](GLFWwindow* window, int width, int height) {
-			
-			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-			data.Width = width;
-			data.Height = height;
-
-			WindowResizeEvent event(width, height);
-			data.EventCallback(event);
-		});
-
-		glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* window) {
-		
-			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-			WindowCloseEvent event;
-			data.EventCallback(event);
-		});
-
-		glfwSetKeyCallback(m_Window, [](GLFWwindow* window, int key, int scancode, int action, int mods) {
-			
-			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-
-			switch (action) {
-
-				case (GLFW_PRESS): {
-				
-					KeyPressedEvent event(key, 0); 
-					data.EventCallback(event);
-					break;
-				}
-				case (GLFW_RELEASE): {
-					KeyReleasedEvent event(key);
-					data.EventCallback(event);
-					break;
-				}
-				case (GLFW_REPEAT): {
-					KeyPressedEvent event(key, 1); 
-					data.EventCallback(event);
-					break;
-				}
-			}
-		});
-
-		glfwSetCharCallback(m_Window, [](GLFWwindow* window, unsigned int keycode) {
-			
-			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-
-			KeyTypedEvent event(keycode);
-			data.EventCallback(event);
-		});
-
-		glfwSetMouseButtonCallback(m_Window, [](GLFWwindow* window, int button, int action, int mods) {
-			
-			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-
-			switch (action) {
-
-				case (GLFW_PRESS): {
-					MouseButtonPressedEvent event(button);
-					data.EventCallback(event);
-					break;
-				}
-				case (GLFW_RELEASE): {
-					MouseButtonReleasedEvent event(button);
-					data.EventCallback(event);
-					break;
-				}
-			}
-		});
-
-		glfwSetScrollCallback(m_Window, [](GLFWwindow* window, double xOffset, double yOffset) {
-			
-			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-
-			MouseScrolledEvent event((float)xOffset, (float)yOffset);
-			data.EventCallback(event);
-		});
-
-		glfwSetCursorPosCallback(m_Window, [](GLFWwindow* window, double xPos, double yPos) {
-			
-			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-
-			MouseMovedEvent event((float)xPos, (float)yPos);
-			data.EventCallback(event);
-		});
+		// Setting GLFW Callbacks, that turn what happens to the window into Hazel events. (see GLFWCallbacks.h)
+		SetGLFWCallbacks(m_Window, m_Data);
 	}
 
 	void WindowsWindow::Shutdown() {
+
+		delete m_Context; // before the window, since the context's resources go away with it
 		glfwDestroyWindow(m_Window);
 	}
 
@@ -173,12 +81,47 @@ namespace Hazel {
 		// Event Queue:			When an event occurs, it gets placed into an event queue.
 		// Event Processing:	On each iteration of your application's main loop, you typically call a function like glfwPollEvents() or glfwWaitEvents(), 
 		//						which processes this queue, triggering the callbacks that you've set for different events.
-		// When an event is detected, the predefined callback function will be called, which calls data.EventCallback(event) -- (which is 
-		// Application::OnEvent() function) and thus leads to the EventDispatcher class, which enables the event to be called by their handle overall. 
+		// When an event is detected, the predefined callback function will be called, which queues the event on the Application's EventQueue.
+		// The queue is then drained at the start of the next frame, calling Application::OnEvent() (and thus the EventDispatcher) for each event.
+		PollEvents();
+		SwapBuffers();
+	}
+
+	void WindowsWindow::PollEvents() {
+
+		HZ_PROFILE_FUNCTION();
 		glfwPollEvents();
+	}
+
+	void WindowsWindow::SwapBuffers() {
 
+		HZ_PROFILE_FUNCTION();
 		m_Context->SwapBuffers();
 	}
+
+	void WindowsWindow::WaitEvents(double timeout) {
+
+		// Puts the thread to sleep until the OS has an event for us, instead of polling. This is what lets an idle tool use ~0% CPU.
+		if (timeout > 0.0)
+			glfwWaitEventsTimeout(timeout);
+		else
+			glfwWaitEvents();
+	}
+
+	void WindowsWindow::Wake() {
+		glfwPostEmptyEvent();
+	}
+
+	float WindowsWindow::GetRefreshRate() const {
+
+		// A windowed GLFW window has no monitor of its own, so this goes by the primary monitor.
+		GLFWmonitor* monitor = glfwGetWindowMonitor(m_Window);
+		if (!monitor)
+			monitor = glfwGetPrimaryMonitor();
+
+		const GLFWvidmode* mode = monitor ? glfwGetVideoMode(monitor) : nullptr;
+		return mode ? (float)mode->refreshRate : 60.0f;
+	}
 	
 
 	// VSYNC, short for Vertical Synchronization, is a display technology used to prevent screen tearing in graphics-intensive applications. 
@@ -188,10 +131,13 @@ namespace Hazel {
 		// When VSync is enabled with a swap interval of 1, glfwSwapBuffers will synchronize the swap to the vertical refresh rate of the display, which prevents 
 		// tearing (where part of one frame and part of another are displayed at the same time). A swap interval greater than 1 would wait multiple refresh cycles, 
 		// effectively reducing the frame rate.
-		if (enabled)
-			glfwSwapInterval(1);
-		else
-			glfwSwapInterval(0);
+		// Needs the context to be current, so it's done on the render thread when there is one.
+		RenderThread::Get().Submit([enabled]() {
+			if (enabled)
+				glfwSwapInterval(1);
+			else
+				glfwSwapInterval(0);
+		});
 
 		m_Data.VSync = enabled;
 	}
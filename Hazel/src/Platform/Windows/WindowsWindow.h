@@ -3,6 +3,8 @@
 #include "Hazel/Window.h"
 #include "Hazel/Renderer/GraphicsContext.h"
 
+#include "Platform/GLFW/GLFWCallbacks.h"
+
 #include <GLFW/glfw3.h>
 
 
@@ -17,20 +19,28 @@ namespace Hazel {
 		virtual ~WindowsWindow();
 
 		void OnUpdate() override; //Update GLFW, swaps buffer. Ran once per frame. 
+		void PollEvents() override;
+		void SwapBuffers() override;
+		void WaitEvents(double timeout = 0.0) override;
+		void Wake() override;
 
 		inline unsigned int GetWidth() const override { return m_Data.Width; }
 		inline unsigned int GetHeight() const override { return m_Data.Height; }
+		float GetRefreshRate() const override;
+		inline bool IsHeadless() const override { return m_Data.Headless; }
 
 		// Window attributes (Accessors && Mutators)
 		inline void SetEventCallback(const EventCallbackFn& callback) override { 
 			// Sets the "EventCallback" std::function<void(Event&)> attribute in the WindowData struct
 			m_Data.EventCallback = callback; 
 		} 
+		inline void SetEventQueue(EventQueue* queue) override { m_Data.Queue = queue; }
 		
 		void SetVSync(bool enabled) override;
 		bool IsVSync() const override;
 
 		inline virtual void* GetNativeWindow() const override { return m_Window; }
+		inline virtual GraphicsContext& GetGraphicsContext() override { return *m_Context; }
 
 	private:
 
@@ -42,20 +52,8 @@ namespace Hazel {
 		GLFWwindow* m_Window;
 		GraphicsContext* m_Context;
 
-		struct WindowData {
-
-			// Groups windows specific data nicely, this struct will be passed, instead of the entire class. 
-			// This struct is passed to the inherited Init() methods, in the invocation "glfwSetWindowUserPointer(m_Window, &m_Data);" 
-			std::string Title;
-			unsigned int Width, Height;
-			bool VSync;
-
-			// using EventCallbackFn = std::function<void(Event&)>; -- declared in superclass "Window"
-			// Callbacks are typically used to handle events such as keyPresses, windowResize, Mousemovement, etc.
-			EventCallbackFn EventCallback;		// This holds "void Application::OnEvent(Event& e);" from the Application class, for example.
-		};
-
-		WindowData m_Data;
+		// Groups windows specific data nicely, this struct is handed to the GLFW callbacks, instead of the entire class. (see GLFWCallbacks.h)
+		GLFWWindowData m_Data;
 	};
 
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <utility>
 #include <algorithm>
 #include <functional>
+#include <atomic>
 
 #include <string>
 #include <sstream>
@@ -14,6 +15,7 @@
 #include <unordered_set>
 
 #include "Hazel/Log.h"
+#include "Hazel/Debug/Instrumentor.h"
 
 #ifdef HZ_PLATFORM_WINDOWS
 	#include <Windows.h>
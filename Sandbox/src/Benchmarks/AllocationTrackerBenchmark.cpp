@@ -0,0 +1,79 @@
+#include "Benchmark.h"
+
+#include "Hazel/Memory/AllocationTracker.h"
+
+
+// What the AllocationTracker costs: new/delete pairs with tracking off, (operator new still puts its header in front) and on. Then a
+// check that allocations are charged to the thread's tag, and that their frees are too, "Check failures" should always be 0.
+// The check runs between two AllocationTracker::NextFrame() calls of its own, so the frame the benchmark runs in loses its counts.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	static constexpr uint32_t s_Iterations = 1000000;
+	static constexpr uint32_t s_CheckAllocations = 1000;
+
+	static double TimeNewDelete() {
+
+		static int* volatile s_Pointer = nullptr;
+		return TimePerCall(s_Iterations, []() {
+			s_Pointer = new int(1);
+			delete s_Pointer;
+		});
+	}
+
+	static uint32_t CheckCounts() {
+
+		uint32_t failures = 0;
+		AllocationTracker::NextFrame();
+
+		std::vector<int*> pointers;
+		pointers.reserve(s_CheckAllocations); // before the tag, so that only the ints are charged to Events
+		{
+			HZ_ALLOCATION_TAG(Events);
+			for (uint32_t i = 0; i < s_CheckAllocations; i++)
+				pointers.push_back(new int(i));
+		}
+
+		AllocationTracker::NextFrame();
+		AllocationTagStats events = AllocationTracker::GetStats().Tags[(size_t)AllocationTag::Events];
+		if (events.FrameAllocations != s_CheckAllocations || events.FrameBytes != s_CheckAllocations * sizeof(int))
+			failures++;
+
+		int64_t liveBefore = events.LiveAllocations;
+		for (int* pointer : pointers)
+			delete pointer; // untagged, but charged back to Events
+
+		AllocationTracker::NextFrame();
+		events = AllocationTracker::GetStats().Tags[(size_t)AllocationTag::Events];
+		if (events.FrameFrees != s_CheckAllocations || liveBefore - events.LiveAllocations != s_CheckAllocations)
+			failures++;
+		return failures;
+	}
+
+	static std::vector<Result> RunAllocationTracker() {
+
+		if (!AllocationTracker::IsCompiledIn())
+			return { { "Compiled out of this build", 0.0, "" } };
+
+		bool enabled = AllocationTracker::IsEnabled();
+
+		AllocationTracker::SetEnabled(false);
+		double untracked = TimeNewDelete();
+
+		AllocationTracker::SetEnabled(true);
+		double tracked = TimeNewDelete();
+		uint32_t failures = CheckCounts();
+
+		AllocationTracker::SetEnabled(enabled);
+
+		return {
+			{ "Check failures", (double)failures, "" },
+			{ "new + delete, tracking off", untracked, "ns" },
+			{ "new + delete, tracking on", tracked, "ns" },
+			{ "Overhead", tracked - untracked, "ns" }
+		};
+	}
+
+	HZ_BENCHMARK("Allocation tracking (new/delete overhead)", RunAllocationTracker);
+}
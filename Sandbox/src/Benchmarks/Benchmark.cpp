@@ -0,0 +1,19 @@
+#include "Benchmark.h"
+
+
+namespace Benchmarks {
+
+	std::vector<Benchmark>& GetRegistry() {
+
+		// Function local static, so that it's constructed before the first HZ_BENCHMARK registers itself, whatever the order of 
+		// static initialisation across the benchmark .cpp files is.
+		static std::vector<Benchmark> s_Registry;
+		return s_Registry;
+	}
+
+	static volatile uint64_t s_Sink = 0;
+
+	void DoNotOptimise(uint64_t value) {
+		s_Sink = s_Sink + value;
+	}
+}
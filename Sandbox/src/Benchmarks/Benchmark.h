@@ -0,0 +1,51 @@
+#pragma once
+
+// Not <Hazel.h>, since it also brings in the EntryPoint (main) which must only be included by SandboxApp.cpp
+#include "Hazel/Layer.h"
+#include "Hazel/Log.h"
+
+#include <chrono>
+
+
+// Micro-benchmarks for the engine, run on demand from the "Benchmarks" ImGui panel (see BenchmarkLayer). Each benchmark lives in 
+// its own .cpp file in this folder, and registers itself with the HZ_BENCHMARK macro.
+namespace Benchmarks {
+
+	struct Result {
+
+		std::string Label;
+		double Value;		// usually nanoseconds per operation, see Unit
+		const char* Unit;
+	};
+
+	using BenchmarkFn = std::vector<Result>(*)();
+
+	struct Benchmark {
+
+		const char* Name;
+		BenchmarkFn Run;
+	};
+
+	std::vector<Benchmark>& GetRegistry();
+
+	struct Registrar {
+		Registrar(const char* name, BenchmarkFn fn) { GetRegistry().push_back({ name, fn }); }
+	};
+
+	// Runs func() iterations times and returns the average time of one call in nanoseconds.
+	template<typename F>
+	double TimePerCall(uint32_t iterations, F&& func) {
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < iterations; i++)
+			func();
+		auto end = std::chrono::high_resolution_clock::now();
+
+		return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+	}
+
+	// Stops the compiler from optimising away a result that's otherwise unused.
+	void DoNotOptimise(uint64_t value);
+}
+
+#define HZ_BENCHMARK(name, fn) static ::Benchmarks::Registrar s_BenchmarkRegistrar_##fn(name, fn)
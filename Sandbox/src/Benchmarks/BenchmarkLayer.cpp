@@ -0,0 +1,82 @@
+#include "BenchmarkLayer.h"
+
+#include "Hazel/Application.h"
+
+#include "imgui/imgui.h"
+
+
+BenchmarkLayer::BenchmarkLayer(const std::vector<std::string>& runAndExit)
+	: Layer("Benchmarks"), m_RunAndExit(runAndExit)
+{
+	SetEventSubscription(0);
+}
+
+void BenchmarkLayer::OnUpdate(Hazel::Timestep ts) {
+
+	if (m_RunAndExit.empty())
+		return;
+
+	uint32_t failures = 0;
+	for (const std::string& name : m_RunAndExit) {
+
+		bool found = false;
+		for (const Benchmarks::Benchmark& benchmark : Benchmarks::GetRegistry()) {
+			if (name == "all" || std::string(benchmark.Name).find(name) != std::string::npos) {
+				failures += RunBenchmark(benchmark);
+				found = true;
+			}
+		}
+
+		if (!found) {
+			HZ_ERROR("No benchmark called '{0}'", name);
+			failures++;
+		}
+	}
+	m_RunAndExit.clear();
+
+	if (failures > 0)
+		HZ_ERROR("Benchmarks done, {0} check(s) failed", failures);
+	else
+		HZ_INFO("Benchmarks done, all checks passed");
+	Hazel::Application::Get().Close(failures > 0 ? 1 : 0);
+}
+
+void BenchmarkLayer::OnImGuiRender() {
+
+	ImGui::Begin("Benchmarks");
+
+	for (const Benchmarks::Benchmark& benchmark : Benchmarks::GetRegistry()) {
+		if (ImGui::Button(benchmark.Name))
+			RunBenchmark(benchmark);
+	}
+
+	if (m_LastBenchmark) {
+
+		ImGui::Separator();
+		ImGui::Text("%s", m_LastBenchmark);
+		for (const Benchmarks::Result& result : m_LastResults)
+			ImGui::Text("%-40s %12.2f %s", result.Label.c_str(), result.Value, result.Unit);
+	}
+
+	ImGui::End();
+}
+
+uint32_t BenchmarkLayer::RunBenchmark(const Benchmarks::Benchmark& benchmark) {
+
+	HZ_INFO("Running benchmark: {0}", benchmark.Name);
+
+	m_LastBenchmark = benchmark.Name;
+	m_LastResults = benchmark.Run();
+
+	uint32_t failures = 0;
+	for (const Benchmarks::Result& result : m_LastResults) {
+
+		if (result.Label == "Check failures" && result.Value != 0.0) {
+			HZ_ERROR("  {0}: {1:.2f} {2}", result.Label, result.Value, result.Unit);
+			failures += (uint32_t)result.Value;
+		}
+		else
+			HZ_INFO("  {0}: {1:.2f} {2}", result.Label, result.Value, result.Unit);
+	}
+	return failures;
+}
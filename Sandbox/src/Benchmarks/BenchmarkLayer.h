@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Benchmark.h"
+
+
+// Lists every registered benchmark in an ImGui window, with a button to run it. Results are shown in the window and logged.
+// Given benchmarks to run, (see SandboxApp.cpp's --benchmark) it runs them on the first frame instead, and closes the Application with
+// an exit code of 1 if any of their checks failed, so a headless run can be used as a test.
+class BenchmarkLayer : public Hazel::Layer {
+
+public:
+
+	// Each name runs the benchmarks whose name contains it, "all" runs every one.
+	BenchmarkLayer(const std::vector<std::string>& runAndExit = {});
+
+	virtual void OnUpdate(Hazel::Timestep ts) override;
+	virtual void OnImGuiRender() override;
+
+private:
+
+	// Returns the benchmark's "Check failures".
+	uint32_t RunBenchmark(const Benchmarks::Benchmark& benchmark);
+
+private:
+
+	std::vector<std::string> m_RunAndExit;
+
+	const char* m_LastBenchmark = nullptr;
+	std::vector<Benchmarks::Result> m_LastResults;
+};
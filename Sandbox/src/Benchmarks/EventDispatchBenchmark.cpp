@@ -0,0 +1,143 @@
+#include "Benchmark.h"
+
+#include "Hazel/Events/ApplicationEvent.h"
+#include "Hazel/Events/KeyEvent.h"
+#include "Hazel/Events/MouseEvent.h"
+#include "Hazel/KeyCodes.h"
+#include "Hazel/MouseButtonCodes.h"
+
+
+// Compares EventDispatcher::Dispatch against the way it used to work. A layer's OnEvent with a dozen Dispatch calls is run over a mix 
+// of events, once with the current templated Dispatch, and once with LegacyEventDispatcher below.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	// Stands in for the virtual Event::GetEventType() that was used before, so that the legacy type query is an indirect call too.
+	static EventType (*volatile s_GetEventTypeIndirect)(const Event&) = [](const Event& e) { return e.GetEventType(); };
+
+	// The old EventDispatcher: a std::function (built from std::bind at every call site) per Dispatch, and an indirect type query.
+	class LegacyEventDispatcher {
+
+		template<typename T>
+		using EventFn = std::function<bool(T&)>;
+
+	public:
+
+		LegacyEventDispatcher(Event& event)
+			: m_Event(event)
+		{}
+
+		template<typename T>
+		bool Dispatch(EventFn<T> func) {
+			if (s_GetEventTypeIndirect(m_Event) == T::GetStaticType()) {
+				m_Event.Handled = func(*(T*)&m_Event);
+				return true;
+			}
+			return false;
+		}
+
+	private:
+
+		Event& m_Event;
+	};
+
+#define LEGACY_BIND_EVENT_FN(x) std::bind(&DispatchTarget::x, this, std::placeholders::_1)
+
+	class DispatchTarget {
+
+	public:
+
+		void OnEvent(Event& e) {
+
+			EventDispatcher dispatcher(e);
+			dispatcher.Dispatch<WindowResizeEvent>(HZ_BIND_EVENT_FN(DispatchTarget::OnWindowResize));
+			dispatcher.Dispatch<WindowCloseEvent>(HZ_BIND_EVENT_FN(DispatchTarget::OnWindowClose));
+			dispatcher.Dispatch<AppTickEvent>(HZ_BIND_EVENT_FN(DispatchTarget::OnAppTick));
+			dispatcher.Dispatch<KeyPressedEvent>(HZ_BIND_EVENT_FN(DispatchTarget::OnKeyPressed));
+			dispatcher.Dispatch<KeyReleasedEvent>(HZ_BIND_EVENT_FN(DispatchTarget::OnKeyReleased));
+			dispatcher.Dispatch<KeyTypedEvent>(HZ_BIND_EVENT_FN(DispatchTarget::OnKeyTyped));
+			dispatcher.Dispatch<MouseButtonPressedEvent>(HZ_BIND_EVENT_FN(DispatchTarget::OnMouseButtonPressed));
+			dispatcher.Dispatch<MouseButtonReleasedEvent>(HZ_BIND_EVENT_FN(DispatchTarget::OnMouseButtonReleased));
+			dispatcher.Dispatch<MouseMovedEvent>(HZ_BIND_EVENT_FN(DispatchTarget::OnMouseMoved));
+			dispatcher.Dispatch<MouseScrolledEvent>(HZ_BIND_EVENT_FN(DispatchTarget::OnMouseScrolled));
+			dispatcher.Dispatch(this, &DispatchTarget::OnMouseMovedAgain);
+			dispatcher.Dispatch<KeyPressedEvent>([this](KeyPressedEvent& e) { m_Count += e.GetRepeatCount(); return false; });
+		}
+
+		void OnEventLegacy(Event& e) {
+
+			LegacyEventDispatcher dispatcher(e);
+			dispatcher.Dispatch<WindowResizeEvent>(LEGACY_BIND_EVENT_FN(OnWindowResize));
+			dispatcher.Dispatch<WindowCloseEvent>(LEGACY_BIND_EVENT_FN(OnWindowClose));
+			dispatcher.Dispatch<AppTickEvent>(LEGACY_BIND_EVENT_FN(OnAppTick));
+			dispatcher.Dispatch<KeyPressedEvent>(LEGACY_BIND_EVENT_FN(OnKeyPressed));
+			dispatcher.Dispatch<KeyReleasedEvent>(LEGACY_BIND_EVENT_FN(OnKeyReleased));
+			dispatcher.Dispatch<KeyTypedEvent>(LEGACY_BIND_EVENT_FN(OnKeyTyped));
+			dispatcher.Dispatch<MouseButtonPressedEvent>(LEGACY_BIND_EVENT_FN(OnMouseButtonPressed));
+			dispatcher.Dispatch<MouseButtonReleasedEvent>(LEGACY_BIND_EVENT_FN(OnMouseButtonReleased));
+			dispatcher.Dispatch<MouseMovedEvent>(LEGACY_BIND_EVENT_FN(OnMouseMoved));
+			dispatcher.Dispatch<MouseScrolledEvent>(LEGACY_BIND_EVENT_FN(OnMouseScrolled));
+			dispatcher.Dispatch<MouseMovedEvent>(LEGACY_BIND_EVENT_FN(OnMouseMovedAgain));
+			dispatcher.Dispatch<KeyPressedEvent>([this](KeyPressedEvent& e) { m_Count += e.GetRepeatCount(); return false; });
+		}
+
+		inline uint64_t GetCount() const { return m_Count; }
+
+	private:
+
+		bool OnWindowResize(WindowResizeEvent& e) { m_Count += e.GetWidth(); return false; }
+		bool OnWindowClose(WindowCloseEvent& e) { m_Count++; return false; }
+		bool OnAppTick(AppTickEvent& e) { m_Count++; return false; }
+		bool OnKeyPressed(KeyPressedEvent& e) { m_Count += e.GetKeyCode(); return false; }
+		bool OnKeyReleased(KeyReleasedEvent& e) { m_Count += e.GetKeyCode(); return false; }
+		bool OnKeyTyped(KeyTypedEvent& e) { m_Count += e.GetKeyCode(); return false; }
+		bool OnMouseButtonPressed(MouseButtonPressedEvent& e) { m_Count += e.GetMouseButton(); return false; }
+		bool OnMouseButtonReleased(MouseButtonReleasedEvent& e) { m_Count += e.GetMouseButton(); return false; }
+		bool OnMouseMoved(MouseMovedEvent& e) { m_Count += (uint64_t)e.GetX(); return false; }
+		bool OnMouseScrolled(MouseScrolledEvent& e) { m_Count += (uint64_t)e.GetYOffset(); return false; }
+		bool OnMouseMovedAgain(MouseMovedEvent& e) { m_Count += (uint64_t)e.GetY(); return false; }
+
+	private:
+
+		uint64_t m_Count = 0;
+	};
+
+	static std::vector<Result> EventDispatchBenchmark() {
+
+		// Roughly what a frame of input looks like, mostly mouse movement.
+		MouseMovedEvent mouseMoved(640.0f, 360.0f, 1.0f, 0.0f);
+		MouseScrolledEvent mouseScrolled(0.0f, 1.0f);
+		KeyPressedEvent keyPressed(HZ_KEY_W, 0);
+		KeyTypedEvent keyTyped(HZ_KEY_W);
+		KeyReleasedEvent keyReleased(HZ_KEY_W);
+		MouseButtonPressedEvent buttonPressed(HZ_MOUSE_BUTTON_LEFT);
+		WindowResizeEvent windowResize(1280, 720);
+
+		Event* events[] = { &mouseMoved, &mouseMoved, &mouseMoved, &mouseMoved, &mouseScrolled, &keyPressed, &keyTyped, &keyReleased, &buttonPressed, &windowResize };
+		constexpr uint32_t eventCount = sizeof(events) / sizeof(events[0]);
+		constexpr uint32_t iterations = 200000;
+
+		DispatchTarget target;
+
+		double current = TimePerCall(iterations, [&]() {
+			for (Event* e : events)
+				target.OnEvent(*e);
+		});
+
+		double legacy = TimePerCall(iterations, [&]() {
+			for (Event* e : events)
+				target.OnEventLegacy(*e);
+		});
+
+		DoNotOptimise(target.GetCount());
+
+		return {
+			{ "EventDispatcher (per event, 12 Dispatch calls)", current / eventCount, "ns" },
+			{ "std::function + std::bind (per event)", legacy / eventCount, "ns" },
+			{ "Speedup", legacy / current, "x" }
+		};
+	}
+
+	HZ_BENCHMARK("Event dispatch", EventDispatchBenchmark);
+}
@@ -0,0 +1,104 @@
+#include "Benchmark.h"
+
+#include "Hazel/Memory/FrameAllocator.h"
+
+#include <charconv>
+#include <cstring>
+
+
+// A frame's worth of transient allocations, the kind events and debug text make: a few hundred short strings built a piece at a time,
+// (like Event::ToString()) and a vector grown one push_back at a time. Once on the heap, once on a FrameAllocator of the
+// benchmark's own, (not the engine's, which the frame this runs in is using) with NextFrame() between frames. Then a check that memory
+// survives the next frame and is reused the one after, "Check failures" should always be 0.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	static constexpr uint32_t s_Frames = 200;
+	static constexpr uint32_t s_StringsPerFrame = 300;
+	static constexpr uint32_t s_ValuesPerFrame = 2000;
+
+	// String and Vector are a std::basic_string and a std::vector with the same allocator, either the standard one or FrameStlAllocator.
+	template<typename String, typename Vector>
+	static uint64_t SimulateFrame(uint32_t frame, const typename String::allocator_type& allocator) {
+
+		uint64_t checksum = 0;
+		char number[16];
+		for (uint32_t i = 0; i < s_StringsPerFrame; i++) {
+
+			String string(allocator);
+			string += "MouseMovedEvent: ";
+			string.append(number, std::to_chars(number, number + sizeof(number), frame).ptr);
+			string += ", ";
+			string.append(number, std::to_chars(number, number + sizeof(number), i).ptr);
+			checksum += string.size();
+		}
+
+		Vector values{ typename Vector::allocator_type(allocator) };
+		for (uint32_t i = 0; i < s_ValuesPerFrame; i++)
+			values.push_back(frame + i);
+		return checksum + values.size();
+	}
+
+	static uint32_t CheckLifetime() {
+
+		FrameAllocator allocator(4096);
+		uint32_t failures = 0;
+
+		char* first = static_cast<char*>(allocator.Allocate(64));
+		std::memset(first, 'a', 64);
+		allocator.NextFrame();
+
+		// Still there the frame after, and the other frame's memory doesn't overlap it.
+		char* second = static_cast<char*>(allocator.Allocate(64));
+		std::memset(second, 'b', 64);
+		if (first[0] != 'a' || first[63] != 'a' || (second < first + 64 && first < second + 64))
+			failures++;
+		allocator.NextFrame();
+
+		// Two frames on, first's memory is handed out again.
+		if (allocator.Allocate(64) != first)
+			failures++;
+#if HZ_FRAME_ALLOCATOR_POISON
+		if ((uint8_t)first[1] != FrameAllocator::PoisonByte)
+			failures++;
+#endif
+
+		// Bigger than a block, and alignment.
+		void* big = allocator.Allocate(3 * 4096, 256);
+		if (!big || ((uintptr_t)big & 255) != 0)
+			failures++;
+		return failures;
+	}
+
+	static std::vector<Result> RunFrameAllocator() {
+
+		uint64_t checksum = 0;
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_Frames; frame++)
+			checksum += SimulateFrame<std::string, std::vector<uint32_t>>(frame, std::allocator<char>());
+		double heapMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+		FrameAllocator allocator;
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_Frames; frame++) {
+			checksum += SimulateFrame<FrameString, FrameVector<uint32_t>>(frame, FrameStlAllocator<char>(allocator));
+			allocator.NextFrame();
+		}
+		double frameMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		DoNotOptimise(checksum);
+
+		FrameAllocatorStats stats = allocator.GetStats();
+		return {
+			{ "Check failures", (double)CheckLifetime(), "" },
+			{ "Heap, per frame", heapMs / s_Frames * 1000.0, "us" },
+			{ "FrameAllocator, per frame", frameMs / s_Frames * 1000.0, "us" },
+			{ "FrameAllocator, allocations per frame", (double)stats.Allocations, "" },
+			{ "FrameAllocator, high-water mark", stats.HighWater / 1024.0, "KB" },
+			{ "Speedup", heapMs / frameMs, "x" }
+		};
+	}
+
+	HZ_BENCHMARK("Frame allocator (transient strings and vectors)", RunFrameAllocator);
+}
@@ -0,0 +1,161 @@
+#include "Benchmark.h"
+
+#include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/VertexArray.h"
+
+#include <cmath>
+
+
+// The same N quads drawn with Renderer::Submit() once per object, and with one Renderer::SubmitInstanced() over a per-instance 
+// transform/colour buffer, from 1k to 1M instances. (per-object submission stops at 100k, past that it's just a very long wait)
+// Through the Application's RendererAPI, CPU time only: the GPU may still be drawing when the clock stops.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	struct InstanceData {
+
+		glm::mat4 Transform;
+		glm::vec4 Color;
+	};
+
+	static const char* s_InstancedVertexSrc = R"(
+		#version 330 core
+
+		layout(location = 0) in vec3 a_Position;
+		layout(location = 1) in mat4 i_Transform; // takes locations 1 to 4
+		layout(location = 5) in vec4 i_Color;
+
+		uniform mat4 u_ViewProjection;
+
+		out vec4 v_Color;
+
+		void main() {
+
+			v_Color = i_Color;
+			gl_Position = u_ViewProjection * i_Transform * vec4(a_Position, 1.0);
+		}
+	)";
+
+	static const char* s_PerObjectVertexSrc = R"(
+		#version 330 core
+
+		layout(location = 0) in vec3 a_Position;
+
+		uniform mat4 u_ViewProjection;
+		uniform mat4 u_Transform;
+
+		void main() {
+			gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
+		}
+	)";
+
+	static const char* s_InstancedFragmentSrc = R"(
+		#version 330 core
+
+		layout(location = 0) out vec4 color;
+
+		in vec4 v_Color;
+
+		void main() {
+			color = v_Color;
+		}
+	)";
+
+	static const char* s_PerObjectFragmentSrc = R"(
+		#version 330 core
+
+		layout(location = 0) out vec4 color;
+
+		void main() {
+			color = vec4(1.0, 0.5, 0.2, 1.0);
+		}
+	)";
+
+	static std::shared_ptr<VertexBuffer> CreateQuadVertices() {
+
+		float vertices[4 * 3] = {
+			-0.5f, -0.5f, 0.0f,
+			 0.5f, -0.5f, 0.0f,
+			 0.5f,  0.5f, 0.0f,
+			-0.5f,  0.5f, 0.0f
+		};
+
+		std::shared_ptr<VertexBuffer> vertexBuffer(VertexBuffer::Create(vertices, sizeof(vertices)));
+		vertexBuffer->SetLayout({ { ShaderDataType::Float3, "a_Position" } });
+		return vertexBuffer;
+	}
+
+	static glm::mat4 InstanceTransform(uint32_t i, uint32_t count) {
+
+		uint32_t side = (uint32_t)std::sqrt((float)count) + 1;
+		float scale = 2.0f / side;
+
+		glm::mat4 transform(scale);
+		transform[3] = { (float)(i % side) * scale - 1.0f, (float)(i / side) * scale - 1.0f, 0.0f, 1.0f };
+		return transform;
+	}
+
+	static std::vector<Result> RunInstancing() {
+
+		static constexpr uint32_t counts[] = { 1000, 10000, 100000, 1000000 };
+		static constexpr uint32_t maxPerObjectCount = 100000;
+
+		uint32_t indices[6] = { 0, 1, 2, 2, 3, 0 };
+		std::shared_ptr<IndexBuffer> indexBuffer(IndexBuffer::Create(indices, 6));
+		std::shared_ptr<VertexBuffer> quadVertices = CreateQuadVertices();
+
+		std::shared_ptr<VertexArray> perObjectVertexArray(VertexArray::Create());
+		perObjectVertexArray->AddVertexBuffer(quadVertices);
+		perObjectVertexArray->SetIndexBuffer(indexBuffer);
+
+		std::shared_ptr<Shader> perObjectShader(Shader::Create(s_PerObjectVertexSrc, s_PerObjectFragmentSrc));
+		std::shared_ptr<Shader> instancedShader(Shader::Create(s_InstancedVertexSrc, s_InstancedFragmentSrc));
+
+		std::vector<Result> results;
+		for (uint32_t count : counts) {
+
+			std::vector<InstanceData> instances(count);
+			for (uint32_t i = 0; i < count; i++)
+				instances[i] = { InstanceTransform(i, count), { (float)(i % 256) / 255.0f, 0.4f, 0.8f, 1.0f } };
+
+			std::string label = std::to_string(count / 1000) + "k";
+
+			if (count <= maxPerObjectCount) {
+
+				double ns = TimePerCall(1, [&]() {
+					Renderer::BeginScene(glm::mat4(1.0f));
+					for (const InstanceData& instance : instances)
+						Renderer::Submit(perObjectShader, perObjectVertexArray, instance.Transform);
+					Renderer::EndScene();
+				});
+				results.push_back({ label + " per-object: frame", ns / 1e6, "ms" });
+			}
+
+			// The instance buffer is re-uploaded every time, as it would be when the instances move.
+			std::shared_ptr<VertexBuffer> instanceBuffer(VertexBuffer::Create(count * (uint32_t)sizeof(InstanceData)));
+			instanceBuffer->SetLayout(BufferLayout({
+				{ ShaderDataType::Mat4,   "i_Transform" },
+				{ ShaderDataType::Float4, "i_Color"     }
+			}, 1));
+
+			std::shared_ptr<VertexArray> instancedVertexArray(VertexArray::Create());
+			instancedVertexArray->AddVertexBuffer(quadVertices);
+			instancedVertexArray->AddVertexBuffer(instanceBuffer);
+			instancedVertexArray->SetIndexBuffer(indexBuffer);
+
+			double ns = TimePerCall(1, [&]() {
+				instanceBuffer->SetData(instances.data(), count * (uint32_t)sizeof(InstanceData));
+				Renderer::BeginScene(glm::mat4(1.0f));
+				Renderer::SubmitInstanced(instancedShader, instancedVertexArray, count);
+				Renderer::EndScene();
+			});
+			results.push_back({ label + " instanced: frame", ns / 1e6, "ms" });
+			results.push_back({ label + " instanced: time / instance", ns / count, "ns" });
+		}
+
+		return results;
+	}
+
+	HZ_BENCHMARK("Instanced rendering (1k to 1M)", RunInstancing);
+}
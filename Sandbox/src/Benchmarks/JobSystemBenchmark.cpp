@@ -0,0 +1,148 @@
+#include "Benchmark.h"
+
+#include "Hazel/Jobs/JobSystem.h"
+
+#include <cmath>
+#include <string>
+#include <thread>
+
+
+// How the JobSystem scales: a ParallelFor over particles, (a few hundred nanoseconds of math each, like an animation or culling pass)
+// with the engine's JobSystem restarted at 1, 2, 4... threads, up to one per hardware thread, then put back the way it was. Also what
+// a job costs on its own, and a check that every index is visited exactly once, that children are waited for, and that jobs Run()
+// from a thread that isn't a worker run too, "Check failures" should always be 0.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	static constexpr uint32_t s_Particles = 200000;
+	static constexpr uint32_t s_GrainSize = 256;
+	static constexpr uint32_t s_EmptyJobs = 100000;
+
+	struct Particle {
+
+		float X, Y, VelocityX, VelocityY;
+	};
+
+	static void Simulate(std::vector<Particle>& particles, uint32_t begin, uint32_t end) {
+
+		for (uint32_t i = begin; i < end; i++) {
+
+			Particle& particle = particles[i];
+			for (int step = 0; step < 16; step++) {
+				float angle = std::atan2(particle.VelocityY, particle.VelocityX) + 0.01f;
+				particle.VelocityX = std::cos(angle);
+				particle.VelocityY = std::sin(angle);
+				particle.X += particle.VelocityX * 0.016f;
+				particle.Y += particle.VelocityY * 0.016f;
+			}
+		}
+	}
+
+	static double TimeSimulation(std::vector<Particle>& particles) {
+
+		auto start = std::chrono::high_resolution_clock::now();
+		JobSystem::Get().ParallelFor(s_Particles, s_GrainSize, [&particles](uint32_t begin, uint32_t end) {
+			Simulate(particles, begin, end);
+		});
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	}
+
+	static uint32_t CheckJobs() {
+
+		JobSystem& jobs = JobSystem::Get();
+		uint32_t failures = 0;
+
+		// Every index exactly once, with a grain small enough for lots of splitting and stealing.
+		std::vector<std::atomic<uint32_t>> visits(10000);
+		jobs.ParallelFor((uint32_t)visits.size(), 7, [&visits](uint32_t begin, uint32_t end) {
+			for (uint32_t i = begin; i < end; i++)
+				visits[i].fetch_add(1, std::memory_order_relaxed);
+		});
+		for (std::atomic<uint32_t>& count : visits) {
+			if (count.load() != 1) {
+				failures++;
+				break;
+			}
+		}
+
+		// A job's children (and theirs) are done by the time its counter is.
+		std::atomic<uint32_t> grandchildren{ 0 };
+		JobCounter counter;
+		jobs.Run(counter, [&jobs, &grandchildren]() {
+			for (int i = 0; i < 8; i++) {
+				jobs.RunChild([&jobs, &grandchildren]() {
+					for (int j = 0; j < 8; j++)
+						jobs.RunChild([&grandchildren]() { grandchildren.fetch_add(1, std::memory_order_relaxed); });
+				});
+			}
+		});
+		jobs.Wait(counter);
+		if (grandchildren.load() != 64)
+			failures++;
+
+		// From a thread that isn't one of the job system's, through the shared queue.
+		std::atomic<uint32_t> ran{ 0 };
+		std::thread([&jobs, &ran]() {
+			JobCounter counter;
+			for (int i = 0; i < 100; i++)
+				jobs.Run(counter, [&ran]() { ran.fetch_add(1, std::memory_order_relaxed); });
+			jobs.Wait(counter);
+		}).join();
+		if (ran.load() != 100)
+			failures++;
+
+		return failures;
+	}
+
+	static std::vector<Result> RunJobSystem() {
+
+		JobSystem& jobs = JobSystem::Get();
+		bool wasRunning = jobs.IsRunning();
+		uint32_t threadCount = jobs.GetThreadCount();
+		uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+		std::vector<Particle> particles(s_Particles, { 0.0f, 0.0f, 1.0f, 0.0f });
+		std::vector<Result> results;
+
+		jobs.Stop();
+		double serial = TimeSimulation(particles); // not running, ParallelFor is a plain loop
+		results.push_back({ "Simulation, serial", serial, "ms" });
+
+		double emptyJob = 0.0;
+		uint32_t failures = 0;
+		for (uint32_t threads = 1; ; threads = std::min(threads * 2, hardwareThreads)) {
+
+			jobs.Start(threads);
+			TimeSimulation(particles); // wakes the workers up
+			double milliseconds = TimeSimulation(particles);
+			results.push_back({ "Simulation, " + std::to_string(threads) + " thread(s)", milliseconds, "ms" });
+			results.push_back({ "Speedup, " + std::to_string(threads) + " thread(s)", serial / milliseconds, "x" });
+
+			if (threads == hardwareThreads) {
+
+				failures = CheckJobs();
+				emptyJob = TimePerCall(s_EmptyJobs, [&jobs]() {
+					JobCounter counter;
+					jobs.Run(counter, []() {});
+					jobs.Wait(counter);
+				});
+				jobs.Stop();
+				break;
+			}
+			jobs.Stop();
+		}
+
+		if (wasRunning)
+			jobs.Start(threadCount);
+
+		DoNotOptimise((uint64_t)particles[0].X);
+		results.insert(results.begin(), {
+			{ "Check failures", (double)failures, "" },
+			{ "Empty job, Run() + Wait()", emptyJob, "ns" }
+		});
+		return results;
+	}
+
+	HZ_BENCHMARK("Job system (ParallelFor scaling)", RunJobSystem);
+}
@@ -0,0 +1,128 @@
+#include "Benchmark.h"
+
+#include "Hazel/LayerStack.h"
+#include "Hazel/Jobs/JobSystem.h"
+
+#include <cmath>
+
+
+// LayerStack::OnUpdate() over layers that each do about the same work, (a few hundred microseconds, like audio mixing or AI) once
+// with none of them opted into parallel updates, once with all of them, on data of their own. It's only faster with the JobSystem
+// running on more than one core. Then a check of the schedule a mix of layers gets, and that layers that write the same data never
+// overlap, "Check failures" should always be 0.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	static constexpr uint32_t s_Layers = 8;
+	static constexpr uint32_t s_Frames = 20;
+	static constexpr uint32_t s_WorkPerUpdate = 20000;
+
+	class BusyLayer : public Layer {
+
+	public:
+
+		BusyLayer(bool parallel, uint32_t reads, uint32_t writes, std::atomic<int>* writers = nullptr)
+			: Layer("BusyLayer"), m_Writers(writers) {
+
+			if (parallel)
+				SetParallelUpdate(reads, writes);
+		}
+
+		void OnUpdate(Timestep ts) override {
+
+			// Another layer writing the same data at the same time would find the count above 0.
+			if (m_Writers && m_Writers->fetch_add(1) != 0)
+				Overlaps.fetch_add(1);
+
+			float value = (float)ts;
+			for (uint32_t i = 0; i < s_WorkPerUpdate; i++)
+				value = std::sin(value) + 1.0f;
+			m_Value = value; // the layer's own data
+
+			if (m_Writers)
+				m_Writers->fetch_sub(1);
+		}
+
+		static std::atomic<uint32_t> Overlaps;
+
+	private:
+
+		std::atomic<int>* m_Writers;
+		float m_Value = 0.0f;
+	};
+
+	std::atomic<uint32_t> BusyLayer::Overlaps{ 0 };
+
+	static double TimeUpdates(bool parallel) {
+
+		LayerStack layers;
+		for (uint32_t i = 0; i < s_Layers; i++)
+			layers.PushLayer(new BusyLayer(parallel, 0, BIT(i)));
+
+		FrameStats frameStats;
+		layers.OnUpdate(0.016f, frameStats); // builds the schedule, and wakes the workers up
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_Frames; frame++)
+			layers.OnUpdate(0.016f, frameStats);
+		auto end = std::chrono::high_resolution_clock::now();
+
+		return std::chrono::duration<double, std::milli>(end - start).count() / s_Frames;
+	}
+
+	static uint32_t CheckSchedule() {
+
+		uint32_t failures = 0;
+		std::atomic<int> writers{ 0 };
+
+		// A and B write different data, C reads A's, D isn't parallel, E writes A's data again and F reads B's, which nobody after D writes.
+		LayerStack layers;
+		layers.PushLayer(new BusyLayer(true, 0, BIT(0), &writers));	// A
+		layers.PushLayer(new BusyLayer(true, 0, BIT(1)));			// B
+		layers.PushLayer(new BusyLayer(true, BIT(0), 0));			// C
+		layers.PushLayer(new BusyLayer(false, 0, 0));				// D
+		layers.PushLayer(new BusyLayer(true, 0, BIT(0), &writers));	// E
+		layers.PushLayer(new BusyLayer(true, BIT(1), 0));			// F
+
+		const std::vector<LayerUpdateStage>& schedule = layers.GetUpdateSchedule();
+		const size_t expected[] = { 2, 1, 1, 2 }; // [A B] [C] [D] [E F]
+		if (schedule.size() != 4)
+			failures++;
+		else {
+			for (size_t i = 0; i < schedule.size(); i++) {
+				if (schedule[i].Layers.size() != expected[i])
+					failures++;
+			}
+		}
+
+		// Lots of layers writing the same data, they have to take turns.
+		for (uint32_t i = 0; i < s_Layers; i++)
+			layers.PushLayer(new BusyLayer(true, 0, BIT(0), &writers));
+
+		BusyLayer::Overlaps = 0;
+		FrameStats frameStats;
+		for (uint32_t frame = 0; frame < s_Frames; frame++)
+			layers.OnUpdate(0.016f, frameStats);
+		if (BusyLayer::Overlaps.load() != 0)
+			failures++;
+
+		return failures;
+	}
+
+	static std::vector<Result> RunLayerUpdate() {
+
+		double sequential = TimeUpdates(false);
+		double parallel = TimeUpdates(true);
+
+		return {
+			{ "Check failures", (double)CheckSchedule(), "" },
+			{ "Job system threads", (double)JobSystem::Get().GetThreadCount(), "" },
+			{ "Sequential layers, per frame", sequential, "ms" },
+			{ "Parallel layers, per frame", parallel, "ms" },
+			{ "Speedup", sequential / parallel, "x" }
+		};
+	}
+
+	HZ_BENCHMARK("Layer updates (parallel update group)", RunLayerUpdate);
+}
@@ -0,0 +1,154 @@
+#include "Benchmark.h"
+
+#include "Hazel/Events/KeyEvent.h"
+#include "Hazel/Events/MouseEvent.h"
+#include "Hazel/Memory/PoolAllocator.h"
+
+#include <cstdlib>
+#include <thread>
+
+
+// An event storm: batches of key and mouse events made on the heap and then freed, the way events that outlive their callback are.
+// Once through the PoolAllocator, (MakeEvent() and EventPtr) once through malloc and placement new, on one thread and then on
+// s_Threads at the same time. Then a check that freed blocks are reused, that blocks freed on another thread than the one that
+// allocated them are too, and that EventPtr frees with the right size, "Check failures" should always be 0.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	static constexpr uint32_t s_EventsPerThread = 500000;
+	static constexpr uint32_t s_BatchSize = 256;
+	static constexpr uint32_t s_Threads = 4;
+
+	struct PooledEvents {
+
+		using Pointer = EventPtr;
+
+		template<typename T, typename... Args>
+		static Pointer Make(Args&&... args) { return MakeEvent<T>(std::forward<Args>(args)...); }
+	};
+
+	struct MallocEvents {
+
+		struct Deleter {
+
+			void operator()(Event* event) const { std::free(event); }
+		};
+
+		using Pointer = std::unique_ptr<Event, Deleter>;
+
+		template<typename T, typename... Args>
+		static Pointer Make(Args&&... args) { return Pointer(new (std::malloc(sizeof(T))) T(std::forward<Args>(args)...)); }
+	};
+
+	template<typename Events>
+	static uint64_t Storm() {
+
+		typename Events::Pointer keys[s_BatchSize / 2];
+		typename Events::Pointer moves[s_BatchSize / 2];
+		uint64_t checksum = 0;
+
+		for (uint32_t batch = 0; batch < s_EventsPerThread / s_BatchSize; batch++) {
+
+			for (uint32_t i = 0; i < s_BatchSize / 2; i++) {
+				keys[i] = Events::template Make<KeyPressedEvent>((int)i, 0);
+				moves[i] = Events::template Make<MouseMovedEvent>((float)i, (float)batch);
+			}
+			for (uint32_t i = 0; i < s_BatchSize / 2; i++) {
+				checksum += static_cast<KeyPressedEvent&>(*keys[i]).GetKeyCode() + (uint64_t)static_cast<MouseMovedEvent&>(*moves[i]).GetX();
+				keys[i].reset();
+				moves[i].reset();
+			}
+		}
+		return checksum;
+	}
+
+	// Nanoseconds per event, made and freed, with threadCount threads storming at once.
+	template<typename Events>
+	static double TimeStorm(uint32_t threadCount) {
+
+		std::vector<uint64_t> checksums(threadCount);
+		std::vector<std::thread> threads;
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t t = 0; t < threadCount; t++)
+			threads.emplace_back([&checksums, t]() { checksums[t] = Storm<Events>(); });
+		for (std::thread& thread : threads)
+			thread.join();
+		auto end = std::chrono::high_resolution_clock::now();
+
+		for (uint64_t checksum : checksums)
+			DoNotOptimise(checksum);
+		uint64_t events = (uint64_t)threadCount * (s_EventsPerThread / s_BatchSize) * s_BatchSize;
+		return std::chrono::duration<double, std::nano>(end - start).count() / events;
+	}
+
+	static uint32_t CheckReuse() {
+
+		PoolAllocator& pool = PoolAllocator::Get();
+		uint32_t failures = 0;
+
+		// Freed blocks come straight back.
+		void* first;
+		{
+			EventPtr event = MakeEvent<KeyPressedEvent>(1, 0);
+			first = event.get();
+		}
+		EventPtr second = MakeEvent<KeyPressedEvent>(2, 0);
+		if (second.get() != first)
+			failures++;
+		second.reset();
+
+		// Freed on another thread, over and over: the blocks find their way back, so the pool doesn't keep growing.
+		static_assert(sizeof(MouseMovedEvent) > 16 && sizeof(MouseMovedEvent) <= 32, "MouseMovedEvent changed size class");
+		constexpr uint32_t sizeClass = 1; // 32 bytes
+
+		uint32_t capacity = 0;
+		for (uint32_t round = 0; round < 100; round++) {
+
+			std::vector<EventPtr> events;
+			for (uint32_t i = 0; i < s_BatchSize; i++)
+				events.push_back(MakeEvent<MouseMovedEvent>((float)i, 0.0f));
+
+			std::thread([&events]() { events.clear(); }).join();
+
+			if (round == 0)
+				capacity = pool.GetStats(sizeClass).Capacity;
+		}
+		if (pool.GetStats(sizeClass).Capacity != capacity)
+			failures++;
+
+		// Through Event*, with EventPtr. The block comes back to this thread's cache, and is the next one out.
+		void* block;
+		{
+			EventPtr event = MakeEvent<MouseMovedEvent>(1.0f, 2.0f);
+			block = event.get();
+			if (event->GetEventType() != EventType::MouseMoved)
+				failures++;
+		}
+		EventPtr next = MakeEvent<MouseMovedEvent>(3.0f, 4.0f);
+		if (next.get() != block)
+			failures++;
+		return failures;
+	}
+
+	static std::vector<Result> RunPoolAllocator() {
+
+		double mallocSingle = TimeStorm<MallocEvents>(1);
+		double poolSingle = TimeStorm<PooledEvents>(1);
+		double mallocThreads = TimeStorm<MallocEvents>(s_Threads);
+		double poolThreads = TimeStorm<PooledEvents>(s_Threads);
+
+		return {
+			{ "Check failures", (double)CheckReuse(), "" },
+			{ "malloc, 1 thread", mallocSingle, "ns" },
+			{ "PoolAllocator, 1 thread", poolSingle, "ns" },
+			{ "malloc, 4 threads", mallocThreads, "ns" },
+			{ "PoolAllocator, 4 threads", poolThreads, "ns" },
+			{ "Speedup, 1 thread", mallocSingle / poolSingle, "x" },
+			{ "Speedup, 4 threads", mallocThreads / poolThreads, "x" }
+		};
+	}
+
+	HZ_BENCHMARK("Pool allocator (event storm vs malloc)", RunPoolAllocator);
+}
@@ -0,0 +1,238 @@
+#include "Benchmark.h"
+
+#include "Hazel/Renderer/RenderQueue.h"
+
+#include "Platform/Null/NullRendererAPI.h"
+#include "Platform/Null/NullBuffer.h"
+#include "Platform/Null/NullVertexArray.h"
+#include "Platform/Null/NullShader.h"
+#include "Platform/Null/NullTexture.h"
+
+#include <algorithm>
+
+
+// Deterministic check of the RenderQueue, on the Null RendererAPI. A fixed pseudo-random scene (mixed shaders, textures, meshes, 
+// passes and blend modes) is submitted, sorted and executed, then the recorded command stream is checked: passes in order, opaque 
+// before blended, blended back to front, every opaque shader bound once per pass, no redundant binds, and the exact same stream 
+// when run again. "Check failures" should always be 0, and every failed check is logged. Run it as a test with
+// Sandbox --headless --benchmark "Render queue", which exits with 1 when a check fails. The Null objects are created directly, and
+// record into a NullCommandRecorder of the benchmark's own, the Application's RendererAPI isn't used.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	static constexpr uint32_t s_PacketCount = 20000;
+	static constexpr uint32_t s_ShaderCount = 8;
+	static constexpr uint32_t s_TextureCount = 24;
+	static constexpr uint32_t s_MeshCount = 64;
+	static constexpr uint32_t s_PassCount = 3;
+
+	// Same numbers on every machine, every run.
+	struct Random {
+
+		uint32_t State = 0x12345678;
+
+		uint32_t Next() {
+			State = State * 1664525u + 1013904223u;
+			return State >> 8;
+		}
+	};
+
+	struct QueueScene {
+
+		std::vector<std::shared_ptr<Shader>> Shaders;
+		std::vector<std::shared_ptr<Texture>> Textures;
+		std::vector<std::shared_ptr<VertexArray>> Meshes;
+		std::vector<DrawPacket> Packets;
+	};
+
+	static QueueScene CreateScene() {
+
+		QueueScene scene;
+		for (uint32_t i = 0; i < s_ShaderCount; i++)
+			scene.Shaders.push_back(std::make_shared<NullShader>("", "", ""));
+		for (uint32_t i = 0; i < s_TextureCount; i++)
+			scene.Textures.push_back(std::make_shared<NullTexture2D>(1, 1));
+
+		uint32_t indices[6] = { 0, 1, 2, 2, 3, 0 };
+		float vertices[4 * 3] = {};
+		for (uint32_t i = 0; i < s_MeshCount; i++) {
+
+			std::shared_ptr<VertexBuffer> vertexBuffer = std::make_shared<NullVertexBuffer>(vertices, (uint32_t)sizeof(vertices));
+			vertexBuffer->SetLayout({ { ShaderDataType::Float3, "a_Position" } });
+
+			std::shared_ptr<VertexArray> mesh = std::make_shared<NullVertexArray>();
+			mesh->AddVertexBuffer(vertexBuffer);
+			mesh->SetIndexBuffer(std::make_shared<NullIndexBuffer>(indices, 6));
+			scene.Meshes.push_back(mesh);
+		}
+
+		Random random;
+		for (uint32_t i = 0; i < s_PacketCount; i++) {
+
+			DrawPacket packet;
+			packet.Program = scene.Shaders[random.Next() % s_ShaderCount];
+			packet.Material = scene.Textures[random.Next() % s_TextureCount];
+			packet.Mesh = scene.Meshes[random.Next() % s_MeshCount];
+			packet.Depth = (float)(random.Next() % 10000) / 10000.0f;
+			packet.Pass = (uint8_t)(random.Next() % s_PassCount);
+			packet.Blend = (random.Next() % 4 == 0) ? BlendMode::Alpha : BlendMode::Opaque;
+			scene.Packets.push_back(packet);
+		}
+
+		return scene;
+	}
+
+	static uint32_t CheckSortedOrder(const RenderQueue& queue) {
+
+		uint32_t failures = 0;
+		const DrawPacket* previous = nullptr;
+
+		for (uint32_t i = 0; i < queue.GetPacketCount(); i++) {
+
+			const DrawPacket& packet = queue.GetPacket(queue.GetSortedIndex(i));
+			bool blended = packet.Blend != BlendMode::Opaque;
+
+			if (previous) {
+
+				bool previousBlended = previous->Blend != BlendMode::Opaque;
+				if (packet.Pass < previous->Pass)
+					failures++;
+				else if (packet.Pass == previous->Pass) {
+
+					if (previousBlended && !blended)
+						failures++; // opaque after blended
+					else if (blended && previousBlended && packet.Depth > previous->Depth + 1e-4f)
+						failures++; // blended, but not back to front
+				}
+			}
+
+			previous = &packet;
+		}
+
+		// Every opaque shader gets exactly one run per pass.
+		previous = nullptr;
+		std::vector<std::vector<const Shader*>> runs(s_PassCount);
+		for (uint32_t i = 0; i < queue.GetPacketCount(); i++) {
+
+			const DrawPacket& packet = queue.GetPacket(queue.GetSortedIndex(i));
+			if (packet.Blend == BlendMode::Opaque && (!previous || previous->Program != packet.Program || previous->Pass != packet.Pass))
+				runs[packet.Pass].push_back(packet.Program.get());
+			previous = &packet;
+		}
+		for (std::vector<const Shader*>& passRuns : runs) {
+			size_t count = passRuns.size();
+			std::sort(passRuns.begin(), passRuns.end());
+			failures += (uint32_t)(count - (std::unique(passRuns.begin(), passRuns.end()) - passRuns.begin()));
+		}
+
+		return failures;
+	}
+
+	// Binds of the shader that's already bound, or of a texture to the slot it's already bound to, in the recorded stream.
+	static uint32_t CountRedundantBinds(const NullCommandRecorder& recorder) {
+
+		uint32_t redundant = 0;
+		uint32_t shader = 0;
+		uint32_t textures[NullCommandRecorder::MaxTextureSlots] = {};
+		recorder.ForEach([&](NullCommandType type, const void* payload) {
+			if (type == NullCommandType::BindShader) {
+				uint32_t id = ((const NullBindCommand*)payload)->ID;
+				redundant += id == shader;
+				shader = id;
+			}
+			else if (type == NullCommandType::BindTexture) {
+				const NullBindTextureCommand& bind = *(const NullBindTextureCommand*)payload;
+				redundant += textures[bind.Slot] == bind.ID;
+				textures[bind.Slot] = bind.ID;
+			}
+		});
+		return redundant;
+	}
+
+	static std::vector<Result> RunRenderQueue() {
+
+		NullCommandRecorder recorder;
+		ScopedNullCommandRecorder scope(recorder);
+		NullRendererAPI api;
+		QueueScene scene = CreateScene();
+
+		RenderQueue queue;
+		uint32_t failures = 0;
+
+		for (const DrawPacket& packet : scene.Packets)
+			queue.Submit(packet);
+		queue.Sort();
+		if (uint32_t orderFailures = CheckSortedOrder(queue)) {
+			HZ_ERROR("RenderQueue: {0} packet(s) sorted out of order", orderFailures);
+			failures += orderFailures;
+		}
+
+		recorder.Reset();
+		queue.Execute(glm::mat4(1.0f), api);
+		if (uint32_t redundantBinds = CountRedundantBinds(recorder)) {
+			HZ_ERROR("RenderQueue: {0} redundant bind(s)", redundantBinds);
+			failures += redundantBinds;
+		}
+
+		RenderQueueStats stats = queue.GetStats();
+		std::vector<uint8_t> firstStream = recorder.GetStream();
+		queue.Clear();
+
+		// Same scene again, has to give the very same commands.
+		for (const DrawPacket& packet : scene.Packets)
+			queue.Submit(packet);
+		queue.Sort();
+
+		recorder.Reset();
+		queue.Execute(glm::mat4(1.0f), api);
+		if (recorder.GetStream() != firstStream) {
+			HZ_ERROR("RenderQueue: the same scene recorded a different command stream the second time");
+			failures++;
+		}
+		queue.Clear();
+
+		// Sort time on its own, radix sort against std::sort of the same keys.
+		double radixNs = TimePerCall(20, [&]() {
+			for (const DrawPacket& packet : scene.Packets)
+				queue.Submit(packet);
+			queue.Sort();
+			DoNotOptimise(queue.GetSortKey(0));
+			queue.Clear();
+		});
+		double submitNs = TimePerCall(20, [&]() {
+			for (const DrawPacket& packet : scene.Packets)
+				queue.Submit(packet);
+			DoNotOptimise(queue.GetPacketCount());
+			queue.Clear();
+		});
+
+		for (const DrawPacket& packet : scene.Packets)
+			queue.Submit(packet);
+		std::vector<uint64_t> keys(s_PacketCount);
+		for (uint32_t i = 0; i < s_PacketCount; i++)
+			keys[i] = queue.GetSortKey(i);
+		queue.Clear();
+
+		std::vector<uint64_t> sorted(s_PacketCount);
+		double stdSortNs = TimePerCall(20, [&]() {
+			sorted = keys;
+			std::sort(sorted.begin(), sorted.end());
+			DoNotOptimise(sorted[0]);
+		});
+
+		return {
+			{ "Check failures", (double)failures, "" },
+			{ "Packets", (double)stats.Packets, "" },
+			{ "Binds, submission order", (double)stats.SubmissionOrderBinds, "" },
+			{ "Binds, sorted (shader + texture + VAO)", (double)(stats.ShaderBinds + stats.TextureBinds + stats.VertexArrayChanges), "" },
+			{ "Binds avoided", (double)stats.BindsAvoided, "" },
+			{ "Shader binds", (double)stats.ShaderBinds, "" },
+			{ "Blend changes", (double)stats.BlendChanges, "" },
+			{ "Radix sort / packet", (radixNs - submitNs) / s_PacketCount, "ns" },
+			{ "std::sort / packet", stdSortNs / s_PacketCount, "ns" }
+		};
+	}
+
+	HZ_BENCHMARK("Render queue (Null RendererAPI)", RunRenderQueue);
+}
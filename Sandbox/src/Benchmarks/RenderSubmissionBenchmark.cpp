@@ -0,0 +1,203 @@
+#include "Benchmark.h"
+
+#include "Platform/Null/NullRendererAPI.h"
+#include "Platform/Null/NullBuffer.h"
+#include "Platform/Null/NullVertexArray.h"
+#include "Platform/Null/NullShader.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+// Submits the same scene through the Null RendererAPI twice, once in the order it was created (materials interleaved) and once sorted
+// by shader, then vertex array. No GPU involved, so the counts are exact and the same on every machine, and the times are only the CPU 
+// cost of submission. The Null objects are created directly, and record into a NullCommandRecorder of the benchmark's own, so the
+// Application's own RendererAPI isn't touched. Then a check of the command stream a couple of draws record, and of the stats it
+// keeps, "Check failures" should always be 0.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	static constexpr uint32_t s_ShaderCount = 8;
+	static constexpr uint32_t s_MeshCount = 64;
+	static constexpr uint32_t s_DrawCount = 4096;
+	static constexpr uint32_t s_Frames = 200;
+
+	struct DrawItem {
+
+		Shader* Material;
+		std::shared_ptr<VertexArray> Mesh;
+	};
+
+	static std::shared_ptr<VertexArray> CreateQuad() {
+
+		float vertices[4 * 3] = {
+			-0.5f, -0.5f, 0.0f,
+			 0.5f, -0.5f, 0.0f,
+			 0.5f,  0.5f, 0.0f,
+			-0.5f,  0.5f, 0.0f
+		};
+		uint32_t indices[6] = { 0, 1, 2, 2, 3, 0 };
+
+		std::shared_ptr<VertexArray> vertexArray = std::make_shared<NullVertexArray>();
+
+		std::shared_ptr<VertexBuffer> vertexBuffer = std::make_shared<NullVertexBuffer>(vertices, (uint32_t)sizeof(vertices));
+		vertexBuffer->SetLayout({ { ShaderDataType::Float3, "a_Position" } });
+		vertexArray->AddVertexBuffer(vertexBuffer);
+		vertexArray->SetIndexBuffer(std::make_shared<NullIndexBuffer>(indices, 6));
+
+		return vertexArray;
+	}
+
+	static void SubmitFrame(NullRendererAPI& api, const std::vector<DrawItem>& items) {
+
+		api.SetClearColor({ 0.2f, 0.2f, 0.5f, 1 });
+		api.Clear();
+
+		for (const DrawItem& item : items) {
+			item.Material->Bind();
+			api.DrawIndexed(item.Mesh);
+		}
+	}
+
+	static void AddResults(std::vector<Result>& results, const char* order, const NullRenderStats& stats, double nsPerFrame) {
+
+		results.push_back({ std::string(order) + ": draw calls / frame", (double)stats.DrawCalls / s_Frames, "" });
+		results.push_back({ std::string(order) + ": state changes / frame", (double)stats.StateChanges / s_Frames, "" });
+		results.push_back({ std::string(order) + ": redundant state changes / frame", (double)stats.RedundantStateChanges / s_Frames, "" });
+		results.push_back({ std::string(order) + ": submission time / draw", nsPerFrame / s_DrawCount, "ns" });
+	}
+
+	// Every recorded command as (type, payload) pairs, to compare against what's expected.
+	struct RecordedCommand {
+
+		NullCommandType Type;
+		uint32_t Payload[4];
+	};
+
+	static std::vector<RecordedCommand> GetCommands(const NullCommandRecorder& recorder) {
+
+		std::vector<RecordedCommand> commands;
+		recorder.ForEach([&commands](NullCommandType type, const void* payload) {
+
+			RecordedCommand command = { type, {} };
+			if (type == NullCommandType::DrawIndexed)
+				std::memcpy(command.Payload, payload, sizeof(NullDrawIndexedCommand));
+			else if (type != NullCommandType::Clear)
+				std::memcpy(command.Payload, payload, sizeof(uint32_t));
+			commands.push_back(command);
+		});
+		return commands;
+	}
+
+	static uint32_t CheckCommandStream() {
+
+		uint32_t failures = 0;
+
+		NullCommandRecorder recorder;
+		ScopedNullCommandRecorder scope(recorder);
+
+		NullRendererAPI api;
+		api.Init();
+		NullShader shader("", "", "");
+		std::shared_ptr<VertexArray> quad = CreateQuad();
+		uint32_t quadID = static_cast<NullVertexArray*>(quad.get())->GetID();
+
+		quad->Unbind(); // creating it left it bound
+
+		// The second draw binds the same shader and vertex array again, which is recorded, but counted as redundant.
+		recorder.Reset();
+		shader.Bind();
+		api.DrawIndexed(quad);
+		shader.Bind();
+		api.DrawIndexed(quad, 3, 1);
+		api.Clear();
+
+		std::vector<RecordedCommand> commands = GetCommands(recorder);
+		const NullCommandType expected[] = {
+			NullCommandType::BindShader, NullCommandType::BindVertexArray, NullCommandType::DrawIndexed,
+			NullCommandType::BindShader, NullCommandType::BindVertexArray, NullCommandType::DrawIndexed,
+			NullCommandType::Clear
+		};
+
+		if (commands.size() != sizeof(expected) / sizeof(expected[0]))
+			return failures + 1;
+		for (size_t i = 0; i < commands.size(); i++) {
+			if (commands[i].Type != expected[i])
+				failures++;
+		}
+
+		uint32_t shaderID = commands[0].Payload[0];
+		if (shaderID == 0 || commands[3].Payload[0] != shaderID)
+			failures++;
+		if (commands[1].Payload[0] != quadID || commands[4].Payload[0] != quadID)
+			failures++;
+
+		const uint32_t firstDraw[4] = { quadID, 6, 0, 1 };	// the whole index buffer
+		const uint32_t secondDraw[4] = { quadID, 3, 1, 1 };	// 3 indices, from vertex 1
+		if (std::memcmp(commands[2].Payload, firstDraw, sizeof(firstDraw)) != 0)
+			failures++;
+		if (std::memcmp(commands[5].Payload, secondDraw, sizeof(secondDraw)) != 0)
+			failures++;
+
+		const NullRenderStats& stats = recorder.GetStats();
+		if (stats.Commands != 7 || stats.DrawCalls != 2 || stats.Indices != 9 || stats.Clears != 1)
+			failures++;
+		if (stats.StateChanges != 4 || stats.RedundantStateChanges != 2)
+			failures++;
+
+		// With the stream off, commands are still counted, but not recorded.
+		recorder.SetStreamEnabled(false);
+		recorder.Reset();
+		api.DrawIndexed(quad);
+		if (!recorder.GetStream().empty() || recorder.GetStats().DrawCalls != 1)
+			failures++;
+
+		return failures;
+	}
+
+	static std::vector<Result> RunRenderSubmission() {
+
+		NullCommandRecorder recorder;
+		ScopedNullCommandRecorder scope(recorder);
+		recorder.SetStreamEnabled(false);
+
+		NullRendererAPI api;
+		api.Init();
+
+		std::vector<std::unique_ptr<Shader>> shaders;
+		for (uint32_t i = 0; i < s_ShaderCount; i++)
+			shaders.emplace_back(new NullShader("", "", ""));
+
+		std::vector<std::shared_ptr<VertexArray>> meshes;
+		for (uint32_t i = 0; i < s_MeshCount; i++)
+			meshes.push_back(CreateQuad());
+
+		std::vector<Result> results;
+		results.push_back({ "Check failures", (double)CheckCommandStream(), "" });
+		results.push_back({ "Upload: bytes (scene setup)", (double)recorder.GetStats().BytesUploaded, "B" });
+
+		// Creation order cycles through the shaders and meshes, like a scene that was never sorted.
+		std::vector<DrawItem> items;
+		items.reserve(s_DrawCount);
+		for (uint32_t i = 0; i < s_DrawCount; i++)
+			items.push_back({ shaders[i % s_ShaderCount].get(), meshes[(i * 7) % s_MeshCount] });
+
+		recorder.Reset();
+		double nsPerFrame = TimePerCall(s_Frames, [&]() { SubmitFrame(api, items); });
+		AddResults(results, "Unsorted", recorder.GetStats(), nsPerFrame);
+
+		std::stable_sort(items.begin(), items.end(), [](const DrawItem& a, const DrawItem& b) {
+			if (a.Material != b.Material)
+				return a.Material < b.Material;
+			return a.Mesh.get() < b.Mesh.get();
+		});
+
+		recorder.Reset();
+		nsPerFrame = TimePerCall(s_Frames, [&]() { SubmitFrame(api, items); });
+		AddResults(results, "Sorted", recorder.GetStats(), nsPerFrame);
+		return results;
+	}
+
+	HZ_BENCHMARK("Render submission (Null RendererAPI)", RunRenderSubmission);
+}
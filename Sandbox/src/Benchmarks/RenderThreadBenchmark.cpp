@@ -0,0 +1,122 @@
+#include "Benchmark.h"
+
+#include "Hazel/Renderer/RenderThread.h"
+
+#include <chrono>
+
+
+// RenderThread on its own, without a context: a RenderThread of the benchmark's own (not the engine's) runs plain commands. First a
+// check that commands run once each, in submission order, across many frames, and that Copy()'d data arrives intact, "Check failures"
+// should always be 0. Then simulated frames with fixed CPU costs on both sides: update work on the main thread, and "driver" work in
+// the commands. Run inline, (not started) a frame costs both, on a render thread it costs about the larger of the two.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	static constexpr uint32_t s_CheckFrames = 200;
+	static constexpr uint32_t s_CommandsPerFrame = 500;
+
+	static constexpr uint32_t s_SimulatedFrames = 60;
+	static constexpr uint32_t s_SimulatedCommands = 200;
+	static constexpr double s_UpdateMicroseconds = 2000.0;	// main thread, per frame
+	static constexpr double s_DriverMicroseconds = 1500.0;	// render thread, per frame, spread over the commands
+
+	static void Spin(double microseconds) {
+
+		auto end = std::chrono::steady_clock::now() + std::chrono::duration<double, std::micro>(microseconds);
+		while (std::chrono::steady_clock::now() < end) {}
+	}
+
+	static uint32_t CheckOrder(uint32_t framesInFlight) {
+
+		RenderThread renderThread;
+		renderThread.Start(nullptr, framesInFlight);
+
+		std::vector<uint32_t> executed;
+		executed.reserve(s_CheckFrames * s_CommandsPerFrame);
+		uint32_t copyFailures = 0;
+
+		for (uint32_t frame = 0; frame < s_CheckFrames; frame++) {
+			for (uint32_t i = 0; i < s_CommandsPerFrame; i++) {
+
+				uint32_t sequence = frame * s_CommandsPerFrame + i;
+				uint32_t data[4] = { sequence, sequence * 3, sequence * 7, ~sequence };
+				const uint32_t* copy = (const uint32_t*)renderThread.Copy(data, sizeof(data));
+				data[0] = 0xdeadbeef; // the copy is what the command reads, not the caller's memory
+
+				renderThread.Submit([&executed, &copyFailures, sequence, copy]() {
+					executed.push_back(sequence);
+					if (copy[0] != sequence || copy[1] != sequence * 3 || copy[2] != sequence * 7 || copy[3] != ~sequence)
+						copyFailures++;
+				});
+			}
+			renderThread.Kick();
+		}
+		renderThread.Stop(); // the main thread only looks at executed once the render thread is gone
+
+		uint32_t failures = copyFailures;
+		if (executed.size() != s_CheckFrames * s_CommandsPerFrame)
+			failures++;
+		for (uint32_t i = 0; i < executed.size(); i++)
+			failures += executed[i] != i;
+
+		return failures;
+	}
+
+	// Average milliseconds per simulated frame.
+	static double SimulateFrames(RenderThread& renderThread) {
+
+		auto start = std::chrono::steady_clock::now();
+		for (uint32_t frame = 0; frame < s_SimulatedFrames; frame++) {
+
+			Spin(s_UpdateMicroseconds);
+			for (uint32_t i = 0; i < s_SimulatedCommands; i++)
+				renderThread.Submit([]() { Spin(s_DriverMicroseconds / s_SimulatedCommands); });
+			renderThread.Kick();
+		}
+		renderThread.WaitIdle();
+		auto end = std::chrono::steady_clock::now();
+
+		return std::chrono::duration<double, std::milli>(end - start).count() / s_SimulatedFrames;
+	}
+
+	static std::vector<Result> RunRenderThread() {
+
+		uint32_t failures = CheckOrder(1) + CheckOrder(RenderThread::MaxFramesInFlight);
+
+		RenderThread renderThread;
+		double inlineMs = SimulateFrames(renderThread);
+
+		renderThread.Start(nullptr, 1);
+		double threadedMs = SimulateFrames(renderThread);
+		RenderThreadStats stats = renderThread.GetStats();
+
+		// Cost of recording a small command, (about the size of a bind) and of running it.
+		uint32_t sink = 0;
+		double recordNs = TimePerCall(100, [&]() {
+			for (uint32_t i = 0; i < 1000; i++)
+				renderThread.Submit([&sink, i]() { sink += i; });
+			renderThread.Kick();
+		}) / 1000.0;
+		renderThread.Stop();
+		DoNotOptimise(sink);
+
+		RenderCommandQueue queue;
+		for (uint32_t i = 0; i < 1000; i++)
+			queue.Submit([&sink, i]() { sink += i; });
+		double executeNs = TimePerCall(1, [&]() { queue.Execute(); }) / 1000.0;
+		DoNotOptimise(sink);
+
+		return {
+			{ "Check failures", (double)failures, "" },
+			{ "Frame, single thread", inlineMs, "ms" },
+			{ "Frame, render thread", threadedMs, "ms" },
+			{ "Speedup", inlineMs / threadedMs, "x" },
+			{ "Main thread wait in Kick (last frame)", stats.WaitMilliseconds, "ms" },
+			{ "Record a command", recordNs, "ns" },
+			{ "Execute a command", executeNs, "ns" }
+		};
+	}
+
+	HZ_BENCHMARK("Render thread (no context)", RunRenderThread);
+}
@@ -0,0 +1,89 @@
+#include "Benchmark.h"
+
+#include "Hazel/Renderer/Renderer2D.h"
+
+#include <cmath>
+
+
+// Stress test for the Renderer2D's batching, through whatever RendererAPI the Application runs with. (HZ_RENDERER_API=null for 
+// numbers without the GPU/driver in them) Times are the CPU side of a whole BeginScene() ... EndScene(), per shape.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	static constexpr uint32_t s_Frames = 30;
+	static constexpr uint32_t s_QuadCount = 100000;
+	static constexpr uint32_t s_TextureCount = 64;	// more than fit in a batch, to make it flush on texture slots
+	static constexpr uint32_t s_CircleCount = 20000;
+	static constexpr uint32_t s_LineCount = 20000;
+
+	// Spreads the shapes over clip space, so that they're actually drawn (and visible, for a frame) with the identity view projection.
+	static inline glm::vec3 GridPosition(uint32_t i, uint32_t count) {
+
+		uint32_t side = (uint32_t)std::sqrt((float)count) + 1;
+		return { (float)(i % side) / side * 2.0f - 1.0f, (float)(i / side) / side * 2.0f - 1.0f, 0.0f };
+	}
+
+	template<typename F>
+	static void RunScene(std::vector<Result>& results, const char* scene, uint32_t shapeCount, F&& drawShapes) {
+
+		Renderer2D::ResetStats();
+
+		double nsPerFrame = TimePerCall(s_Frames, [&]() {
+			Renderer2D::BeginScene(glm::mat4(1.0f));
+			drawShapes();
+			Renderer2D::EndScene();
+		});
+
+		const Renderer2D::Statistics& stats = Renderer2D::GetStats();
+		results.push_back({ std::string(scene) + ": time / shape", nsPerFrame / shapeCount, "ns" });
+		results.push_back({ std::string(scene) + ": frame", nsPerFrame / 1e6, "ms" });
+		results.push_back({ std::string(scene) + ": draw calls / frame", (double)stats.DrawCalls / s_Frames, "" });
+		results.push_back({ std::string(scene) + ": early flushes / frame", (double)stats.Flushes / s_Frames, "" });
+	}
+
+	static std::vector<Result> RunRenderer2DStress() {
+
+		std::vector<Result> results;
+
+		RunScene(results, "Colored quads", s_QuadCount, []() {
+			for (uint32_t i = 0; i < s_QuadCount; i++) {
+				float shade = (float)(i % 256) / 255.0f;
+				Renderer2D::DrawQuad(GridPosition(i, s_QuadCount), { 0.004f, 0.004f }, { shade, 0.3f, 1.0f - shade, 1.0f });
+			}
+		});
+
+		std::vector<std::shared_ptr<Texture2D>> textures;
+		for (uint32_t i = 0; i < s_TextureCount; i++) {
+			std::shared_ptr<Texture2D> texture(Texture2D::Create(1, 1));
+			uint32_t pixel = 0xff000000 | (i * 0x00030507);
+			texture->SetData(&pixel, sizeof(uint32_t));
+			textures.push_back(texture);
+		}
+
+		// Textures in runs of 64 quads, so a batch fills its texture slots a few times over before it's full.
+		RunScene(results, "Textured quads", s_QuadCount, [&]() {
+			for (uint32_t i = 0; i < s_QuadCount; i++)
+				Renderer2D::DrawQuad(GridPosition(i, s_QuadCount), { 0.004f, 0.004f }, textures[(i / 64) % s_TextureCount]);
+		});
+
+		RunScene(results, "Rotated quads", s_QuadCount, []() {
+			for (uint32_t i = 0; i < s_QuadCount; i++)
+				Renderer2D::DrawRotatedQuad(GridPosition(i, s_QuadCount), { 0.004f, 0.004f }, (float)i * 0.01f, { 1.0f, 0.8f, 0.2f, 1.0f });
+		});
+
+		RunScene(results, "Circles + lines", s_CircleCount + s_LineCount, []() {
+			for (uint32_t i = 0; i < s_CircleCount; i++)
+				Renderer2D::DrawCircle(GridPosition(i, s_CircleCount), 0.005f, { 0.2f, 1.0f, 0.4f, 1.0f }, 0.5f);
+			for (uint32_t i = 0; i < s_LineCount; i++) {
+				glm::vec3 p0 = GridPosition(i, s_LineCount);
+				Renderer2D::DrawLine(p0, { p0.x + 0.01f, p0.y + 0.01f, 0.0f }, { 1.0f, 1.0f, 1.0f, 1.0f });
+			}
+		});
+
+		Renderer2D::ResetStats();
+		return results;
+	}
+
+	HZ_BENCHMARK("Renderer2D stress", RunRenderer2DStress);
+}
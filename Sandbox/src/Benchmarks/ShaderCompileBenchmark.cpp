@@ -0,0 +1,106 @@
+#include "Benchmark.h"
+
+#include "Hazel/Renderer/RendererAPI.h"
+#include "Hazel/Renderer/Shader.h"
+
+#include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/OpenGL/OpenGLShaderCache.h"
+
+#include <chrono>
+
+
+// s_ShaderCount distinct programs, compiled one after the other (each one waited on before the next is created) and then all loaded
+// into a ShaderLibrary up front, and only waited on at the end. The program binary cache is off meanwhile, and every run uses sources
+// never seen before, so that the driver's own shader cache can't help either. With GL_KHR_parallel_shader_compile the second way should
+// be several times faster, without it the two are about the same. Through the Application's RendererAPI, OpenGL only.
+namespace Benchmarks {
+
+	using namespace Hazel;
+
+	static constexpr uint32_t s_ShaderCount = 32;
+
+	static const char* s_VertexSrc = R"(
+		#version 330 core
+
+		layout(location = 0) in vec3 a_Position;
+
+		uniform mat4 u_ViewProjection;
+		uniform mat4 u_Transform;
+
+		out vec3 v_Position;
+
+		void main() {
+
+			v_Position = a_Position;
+			gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
+		}
+	)";
+
+	// Enough work in it for the compiler to take a while.
+	static const char* s_FragmentSrc = R"(
+		layout(location = 0) out vec4 color;
+
+		in vec3 v_Position;
+
+		void main() {
+
+			vec3 value = v_Position;
+			for (int i = 0; i < 16; i++)
+				value = sin(value * SEED + vec3(i)) * cos(value.zxy * 1.7) + fract(value.yzx * 3.1);
+
+			color = vec4(value * 0.5 + 0.5, 1.0);
+		}
+	)";
+
+	static std::string GetFragmentSource(uint32_t run, uint32_t index) {
+
+		// A different constant is a different program, as far as any cache is concerned.
+		return "#version 330 core\n#define SEED " + std::to_string(run) + "." + std::to_string(index + 1) + "\n" + s_FragmentSrc;
+	}
+
+	static double Milliseconds(std::chrono::high_resolution_clock::time_point start) {
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	}
+
+	static std::vector<Result> RunShaderCompile() {
+
+		if (RendererAPI::GetAPI() != RendererAPI::API::OpenGL)
+			return { { "OpenGL only", 0.0, "" } };
+
+		// Different sources every run, even across launches.
+		uint32_t run = (uint32_t)(std::chrono::system_clock::now().time_since_epoch().count() % 1000000);
+		bool cacheEnabled = OpenGLShaderCache::IsEnabled();
+		OpenGLShaderCache::SetEnabled(false);
+
+		auto start = std::chrono::high_resolution_clock::now();
+		std::vector<std::shared_ptr<Shader>> shaders;
+		for (uint32_t i = 0; i < s_ShaderCount; i++) {
+			shaders.emplace_back(Shader::Create(s_VertexSrc, GetFragmentSource(run, i)));
+			shaders.back()->WaitUntilReady();
+		}
+		double serialMs = Milliseconds(start);
+		shaders.clear();
+
+		start = std::chrono::high_resolution_clock::now();
+		ShaderLibrary library;
+		for (uint32_t i = 0; i < s_ShaderCount; i++)
+			library.Load("Shader" + std::to_string(i), s_VertexSrc, GetFragmentSource(run + 1, i));
+		double submitMs = Milliseconds(start);
+
+		uint32_t readyAfterSubmit = library.GetReadyCount();
+		library.WaitUntilReady();
+		double parallelMs = Milliseconds(start);
+		OpenGLShaderCache::SetEnabled(cacheEnabled);
+
+		return {
+			{ "Parallel compile supported", OpenGLShader::IsParallelCompileSupported() ? 1.0 : 0.0, "" },
+			{ "One after the other", serialMs, "ms" },
+			{ "Library, all up front: Load() calls", submitMs, "ms" },
+			{ "Library, all up front: until ready", parallelMs, "ms" },
+			{ "Ready right after the Load() calls", (double)readyAfterSubmit, "shaders" },
+			{ "Speedup", serialMs / parallelMs, "x" }
+		};
+	}
+
+	HZ_BENCHMARK("Shader compilation (32 programs)", RunShaderCompile);
+}
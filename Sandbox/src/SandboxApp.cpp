@@ -2,6 +2,11 @@
 
 #include "imgui/imgui.h"
 
+#include "Benchmarks/BenchmarkLayer.h"
+
+#include <cstdlib>
+#include <cstring>
+
 
 class ExampleLayer : public Hazel::Layer {
 
@@ -9,9 +14,11 @@ public:
 
 	ExampleLayer()
 		: Layer("Example")
-	{}
+	{
+		SetEventSubscription(Hazel::EventTypeMask<Hazel::KeyPressedEvent>());
+	}
 
-	void OnUpdate() override {
+	void OnUpdate(Hazel::Timestep ts) override {
 		if (Hazel::Input::IsKeyPressed(HZ_KEY_TAB))
 			HZ_TRACE("Tab key is pressed (poll)!");
 	}
@@ -35,23 +42,59 @@ public:
 	}
 };
 
+// What the command line asks for, see CreateApplication().
+struct SandboxOptions {
+
+	bool Headless = false;
+	uint64_t FrameLimit = 0;
+	std::vector<std::string> Benchmarks;
+};
+
 class Sandbox : public Hazel::Application {
 
 public:
 
-	Sandbox() {
+	Sandbox(const SandboxOptions& options)
+		: Application(Hazel::WindowProps("Hazel Engine", 1280, 720, options.Headless))
+	{
+		// Opting into event coalescing, so high polling rate mice and drag-resizing don't flood the layers with events every frame.
+		Hazel::EventQueue& events = GetEventQueue();
+		events.SetCoalescing(Hazel::EventType::MouseMoved, Hazel::EventCoalescing::MergeConsecutive);
+		events.SetCoalescing(Hazel::EventType::MouseScrolled, Hazel::EventCoalescing::MergeConsecutive);
+		events.SetCoalescing(Hazel::EventType::WindowResize, Hazel::EventCoalescing::KeepLatest);
+
 		PushLayer(new ExampleLayer());
+		PushLayer(new BenchmarkLayer(options.Benchmarks));
 		//PushOverlay(new Hazel::ImGuiLayer());
+
+		SetFrameLimit(options.FrameLimit);
 	}
 
 	~Sandbox() {}
 };
 
 
-Hazel::Application* Hazel::CreateApplication() {
+// Sandbox [--headless] [--frames <n>] [--benchmark <name>]...
+//   --headless           no window, just an offscreen context (same as HZ_HEADLESS=1 on Linux)
+//   --frames <n>         exits after n frames
+//   --benchmark <name>   runs the benchmarks whose name contains name ("all" for every one) on the first frame, then exits with 1 if
+//                        any of their checks failed, 0 otherwise. Can be given more than once. eg. Sandbox --headless --benchmark all
+Hazel::Application* Hazel::CreateApplication(Hazel::ApplicationCommandLineArgs args) {
+
+	SandboxOptions options;
+	for (int i = 1; i < args.Count; i++) {
+
+		if (std::strcmp(args[i], "--headless") == 0)
+			options.Headless = true;
+		else if (std::strcmp(args[i], "--frames") == 0 && i + 1 < args.Count)
+			options.FrameLimit = std::strtoull(args[++i], nullptr, 10);
+		else if (std::strcmp(args[i], "--benchmark") == 0 && i + 1 < args.Count)
+			options.Benchmarks.push_back(args[++i]);
+		else
+			HZ_WARN("Unknown command line argument '{0}'", args[i]);
+	}
 
 	// In C++, when a subclass is instantiated, the constructor if the superclass is also called before the constructor of the subclass
-	// 
-	return new Sandbox();
+	return new Sandbox(options);
 }
 
@@ -1,5 +1,6 @@
 -- This "premake5.lua" file, when executed in cmd prompt, will generate a .sln file, which along side with the whole repo, it allows
 -- the whole solution to essentially be used. This .sln file is optimised for the IDE Visual Studios 2022. 
+-- On Linux, "premake5 gmake2" (GenerateProjects.sh) generates Makefiles instead, then "make config=release" builds everything.
 
 workspace "Hazel"
 	architecture "x64"
@@ -66,8 +67,7 @@ project "Hazel"
 	links {
 		"GLFW",
 		"GLAD",
-		"ImGui",
-		"opengl32.lib"
+		"ImGui"
 	}
 
 	filter "system:windows"
@@ -79,6 +79,23 @@ project "Hazel"
 			"GLFW_INCLUDE_NONE"
 		}
 
+		links {
+			"opengl32.lib",
+			"winmm.lib" -- timeBeginPeriod(), for FrameLimiter
+		}
+
+		removefiles { "%{prj.name}/src/Platform/Linux/**" }
+
+	filter "system:linux"
+		pic "On"
+
+		defines {
+			"HZ_PLATFORM_LINUX",
+			"GLFW_INCLUDE_NONE"
+		}
+
+		removefiles { "%{prj.name}/src/Platform/Windows/**" }
+
 	filter "configurations:Debug"
 		defines "HZ_DEBUG"
 		runtime "Debug"
@@ -132,6 +149,25 @@ project "Sandbox"
 		{
 			"HZ_PLATFORM_WINDOWS"
 		}
+
+	filter "system:linux"
+		defines
+		{
+			"HZ_PLATFORM_LINUX"
+		}
+
+		-- Hazel is a static library, so its own dependencies are linked here. (order matters for GNU ld) GLFW loads libEGL/libOSMesa
+		-- itself at runtime for the headless mode, so those don't need to be linked.
+		links
+		{
+			"GLFW",
+			"GLAD",
+			"ImGui",
+			"GL",
+			"X11",
+			"dl",
+			"pthread"
+		}
 	
 	filter "configurations:Debug"
 		defines "HZ_DEBUG"